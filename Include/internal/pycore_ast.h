@@ -925,6 +925,7 @@ type_param_ty _PyAST_TypeVarTuple(identifier name, expr_ty default_value, int
 
 
 PyObject* PyAST_mod2obj(mod_ty t);
+PyObject* PyAST_mod2obj_lazy(mod_ty t, PyArena *arena);
 int PyAst_CheckMode(PyObject *ast, int mode);
 mod_ty PyAST_obj2mod(PyObject* ast, PyArena* arena, int mode);
 int PyAST_Check(PyObject* obj);
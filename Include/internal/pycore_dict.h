@@ -157,6 +157,26 @@ extern void _PyDict_Clear_LockHeld(PyObject *op);
 PyAPI_FUNC(void) _PyDict_EnsureSharedOnRead(PyDictObject *mp);
 #endif
 
+/* Estimate how many keys a dict or set will hold at the end of a bulk
+   insertion that still has `remaining` items to go, when the first `seen`
+   items added `added` new keys and the table now holds `used` keys.
+   Returns 0 if the table should just grow as usual.
+
+   Only a source whose items have nearly all been new keys so far is
+   expected to carry on that way: the rate of new keys drops as a source
+   with duplicates goes on, so extrapolating it would over-allocate.  The
+   estimate never exceeds 4 times `used`, so that a misleading prefix costs
+   at most one oversized table. */
+static inline Py_ssize_t
+_PyDict_EstimateBulkSize(Py_ssize_t used, Py_ssize_t seen, Py_ssize_t added,
+                         Py_ssize_t remaining)
+{
+    if (seen < 64 || remaining <= 0 || added < seen - seen / 8) {
+        return 0;
+    }
+    return used + Py_MIN(remaining, used * 3);
+}
+
 #define DKIX_EMPTY (-1)
 #define DKIX_DUMMY (-2)  /* Used internally */
 #define DKIX_ERROR (-3)
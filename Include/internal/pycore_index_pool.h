@@ -11,13 +11,13 @@ extern "C" {
 #  error "this header requires Py_BUILD_CORE define"
 #endif
 
-#ifdef Py_GIL_DISABLED
-
 #include "pycore_interp_structs.h"
 
 // This contains code for allocating unique indices in an array. It is used by
 // the free-threaded build to assign each thread a globally unique index into
-// each code object's thread-local bytecode array.
+// each code object's thread-local bytecode array, and by the _thread module
+// to assign each threading.local object an index into the per-thread cache
+// of local dicts.
 
 
 // Allocate the smallest available index. Returns -1 on error.
@@ -28,8 +28,6 @@ extern void _PyIndexPool_FreeIndex(_PyIndexPool *indices, int32_t index);
 
 extern void _PyIndexPool_Fini(_PyIndexPool *indices);
 
-#endif // Py_GIL_DISABLED
-
 #ifdef __cplusplus
 }
 #endif
@@ -379,6 +379,26 @@ struct _stoptheworld_state {
     Py_ssize_t thread_countdown;  // Number of threads that must pause.
 
     PyThreadState *requester; // Thread that requested the pause (may be NULL).
+
+    // Timing of the current pause (PyTime_PerfCounterRaw() values) and the
+    // thread that paused last, i.e. the one that delayed the pause most.
+    PyTime_t request_time;
+    PyTime_t stopped_time;
+    unsigned long last_thread_id;
+
+    // Statistics on the pauses, returned by sys._get_stop_the_world_stats().
+    struct _stoptheworld_stats {
+        Py_ssize_t count;
+        PyTime_t total_time_to_stop;  // Waiting for threads to pause.
+        PyTime_t max_time_to_stop;
+        PyTime_t total_pause;         // World stopped.
+        PyTime_t max_pause;
+        // Details on the last pause.
+        unsigned long last_requester_id;
+        unsigned long last_slowest_thread_id;
+        PyTime_t last_time_to_stop;
+        PyTime_t last_pause;
+    } stats;
 };
 
 /* Tracks some rare events per-interpreter, used by the optimizer to turn on/off
@@ -712,8 +732,6 @@ struct _Py_interp_static_objects {
 #include "pycore_instruments.h"   // PY_MONITORING_TOOL_IDS
 
 
-#ifdef Py_GIL_DISABLED
-
 // A min-heap of indices
 typedef struct _PyIndexHeap {
     int32_t *values;
@@ -741,6 +759,8 @@ typedef struct _PyIndexPool {
     uint32_t tlbc_generation;
 } _PyIndexPool;
 
+#ifdef Py_GIL_DISABLED
+
 typedef union _Py_unique_id_entry {
     // Points to the next free type id, when part of the freelist
     union _Py_unique_id_entry *next;
@@ -898,6 +918,11 @@ struct _is {
     PyMutex weakref_locks[NUM_WEAKREF_LIST_LOCKS];
     _PyIndexPool tlbc_indices;
 #endif
+    // Indices into the per-thread cache of threading.local dicts and the
+    // next unique tag (see Modules/_threadmodule.c).
+    _PyIndexPool threading_local_indices;
+    uint64_t threading_local_next_tag;
+
     // Per-interpreter list of tasks, any lingering tasks from thread
     // states gets added here and removed from the corresponding
     // thread state's list.
@@ -116,6 +116,11 @@ PyAPI_FUNC(_PyStackRef) _PyCompactLong_Add(PyLongObject *left, PyLongObject *rig
 PyAPI_FUNC(_PyStackRef) _PyCompactLong_Multiply(PyLongObject *left, PyLongObject *right);
 PyAPI_FUNC(_PyStackRef) _PyCompactLong_Subtract(PyLongObject *left, PyLongObject *right);
 
+/* Replace *pv, a compact int owned by the caller, with the compact value x,
+   reusing *pv if the caller holds its only reference.  Set *pv to NULL on
+   error. */
+PyAPI_FUNC(void) _PyCompactLong_InplaceStore(PyObject **pv, Py_ssize_t x);
+
 // Export for 'binascii' shared extension.
 PyAPI_DATA(unsigned char) _PyLong_DigitValue[256];
 
@@ -318,6 +323,13 @@ _PyLong_CheckExactAndCompact(PyObject *op)
     return PyLong_CheckExact(op) && _PyLong_IsCompact((const PyLongObject *)op);
 }
 
+/* Return 1 if x is small enough to be the value of a compact int */
+static inline int
+_PyLong_IsCompactValue(Py_ssize_t x)
+{
+    return (size_t)x + PyLong_MASK < (size_t)PyLong_MASK + PyLong_BASE;
+}
+
 #ifdef __cplusplus
 }
 #endif
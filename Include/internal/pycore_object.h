@@ -871,6 +871,22 @@ _PyObject_HashFast(PyObject *op)
     return PyObject_Hash(op);
 }
 
+// Return the hash of op if it is known without calling tp_hash (the cached
+// hash of an exact str, or the value of a compact exact int), or -1 otherwise.
+// Bulk insertions use it to prefetch hash table slots of upcoming keys.
+static inline Py_hash_t
+_PyObject_PeekHash(PyObject *op)
+{
+    if (PyUnicode_CheckExact(op)) {
+        return PyUnstable_Unicode_GET_CACHED_HASH(op);
+    }
+    if (PyLong_CheckExact(op) && _PyLong_IsCompact((PyLongObject *)op)) {
+        Py_hash_t hash = (Py_hash_t)_PyLong_CompactValue((PyLongObject *)op);
+        return hash == -1 ? -2 : hash;
+    }
+    return -1;
+}
+
 static inline size_t
 _PyType_PreHeaderSize(PyTypeObject *tp)
 {
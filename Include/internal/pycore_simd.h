@@ -0,0 +1,29 @@
+/* SIMD instructions used without checking the CPU at runtime.
+
+   SSE2 is part of the x86-64 baseline, so the code using it is compiled in
+   whenever the compiler targets it.  Other platforms use portable code.
+*/
+
+#ifndef Py_INTERNAL_SIMD_H
+#define Py_INTERNAL_SIMD_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef Py_BUILD_CORE
+#  error "this header requires Py_BUILD_CORE define"
+#endif
+
+#if (defined(__SSE2__) || defined(_M_X64) \
+     || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) \
+    && !defined(_M_ARM64EC)
+#  define _Py_HAVE_SSE2 1
+#  include <emmintrin.h>          // _mm_loadu_si128()
+#else
+#  define _Py_HAVE_SSE2 0
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* !Py_INTERNAL_SIMD_H */
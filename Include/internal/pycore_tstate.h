@@ -55,6 +55,15 @@ typedef struct _PyJitTracerState {
 } _PyJitTracerState;
 #endif
 
+// An entry of the per-thread cache of threading.local dicts.
+struct _Py_threading_local_entry {
+    // Unique (never reused) identifier of the threading.local object that
+    // owns the dict, 0 for an unused entry.
+    uint64_t tag;
+    // Borrowed reference: the dict is owned by the threading.local object.
+    PyObject *localdict;
+};
+
 // Every PyThreadState is actually allocated as a _PyThreadStateImpl. The
 // PyThreadState fields are exposed as part of the C API, although most fields
 // are intended to be private. The _PyThreadStateImpl fields not exposed.
@@ -89,6 +98,13 @@ typedef struct _PyThreadStateImpl {
     struct _qsbr_thread_state *qsbr;  // only used by free-threaded build
     struct llist_node mem_free_queue; // delayed free queue
 
+    // Cache of this thread's threading.local dicts, indexed by the index
+    // assigned to each threading.local object (see Modules/_threadmodule.c).
+    struct {
+        struct _Py_threading_local_entry *entries;
+        Py_ssize_t size;
+    } threading_local_cache;
+
 #ifdef Py_GIL_DISABLED
     // Stack references for the current thread that exist on the C stack
     struct _PyCStackRef *c_stack_refs;
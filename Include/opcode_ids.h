@@ -136,83 +136,85 @@ extern "C" {
 #define BINARY_OP_ADD_INT                      130
 #define BINARY_OP_ADD_UNICODE                  131
 #define BINARY_OP_EXTEND                       132
-#define BINARY_OP_MULTIPLY_FLOAT               133
-#define BINARY_OP_MULTIPLY_INT                 134
-#define BINARY_OP_SUBSCR_DICT                  135
-#define BINARY_OP_SUBSCR_GETITEM               136
-#define BINARY_OP_SUBSCR_LIST_INT              137
-#define BINARY_OP_SUBSCR_LIST_SLICE            138
-#define BINARY_OP_SUBSCR_STR_INT               139
-#define BINARY_OP_SUBSCR_TUPLE_INT             140
-#define BINARY_OP_SUBTRACT_FLOAT               141
-#define BINARY_OP_SUBTRACT_INT                 142
-#define CALL_ALLOC_AND_ENTER_INIT              143
-#define CALL_BOUND_METHOD_EXACT_ARGS           144
-#define CALL_BOUND_METHOD_GENERAL              145
-#define CALL_BUILTIN_CLASS                     146
-#define CALL_BUILTIN_FAST                      147
-#define CALL_BUILTIN_FAST_WITH_KEYWORDS        148
-#define CALL_BUILTIN_O                         149
-#define CALL_ISINSTANCE                        150
-#define CALL_KW_BOUND_METHOD                   151
-#define CALL_KW_NON_PY                         152
-#define CALL_KW_PY                             153
-#define CALL_LEN                               154
-#define CALL_LIST_APPEND                       155
-#define CALL_METHOD_DESCRIPTOR_FAST            156
-#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 157
-#define CALL_METHOD_DESCRIPTOR_NOARGS          158
-#define CALL_METHOD_DESCRIPTOR_O               159
-#define CALL_NON_PY_GENERAL                    160
-#define CALL_PY_EXACT_ARGS                     161
-#define CALL_PY_GENERAL                        162
-#define CALL_STR_1                             163
-#define CALL_TUPLE_1                           164
-#define CALL_TYPE_1                            165
-#define COMPARE_OP_FLOAT                       166
-#define COMPARE_OP_INT                         167
-#define COMPARE_OP_STR                         168
-#define CONTAINS_OP_DICT                       169
-#define CONTAINS_OP_SET                        170
-#define FOR_ITER_GEN                           171
-#define FOR_ITER_LIST                          172
-#define FOR_ITER_RANGE                         173
-#define FOR_ITER_TUPLE                         174
-#define JUMP_BACKWARD_JIT                      175
-#define JUMP_BACKWARD_NO_JIT                   176
-#define LOAD_ATTR_CLASS                        177
-#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   178
-#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      179
-#define LOAD_ATTR_INSTANCE_VALUE               180
-#define LOAD_ATTR_METHOD_LAZY_DICT             181
-#define LOAD_ATTR_METHOD_NO_DICT               182
-#define LOAD_ATTR_METHOD_WITH_VALUES           183
-#define LOAD_ATTR_MODULE                       184
-#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        185
-#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    186
-#define LOAD_ATTR_PROPERTY                     187
-#define LOAD_ATTR_SLOT                         188
-#define LOAD_ATTR_WITH_HINT                    189
-#define LOAD_GLOBAL_BUILTIN                    190
-#define LOAD_GLOBAL_MODULE                     191
-#define LOAD_SUPER_ATTR_ATTR                   192
-#define LOAD_SUPER_ATTR_METHOD                 193
-#define RESUME_CHECK                           194
-#define SEND_GEN                               195
-#define STORE_ATTR_INSTANCE_VALUE              196
-#define STORE_ATTR_SLOT                        197
-#define STORE_ATTR_WITH_HINT                   198
-#define STORE_SUBSCR_DICT                      199
-#define STORE_SUBSCR_LIST_INT                  200
-#define TO_BOOL_ALWAYS_TRUE                    201
-#define TO_BOOL_BOOL                           202
-#define TO_BOOL_INT                            203
-#define TO_BOOL_LIST                           204
-#define TO_BOOL_NONE                           205
-#define TO_BOOL_STR                            206
-#define UNPACK_SEQUENCE_LIST                   207
-#define UNPACK_SEQUENCE_TUPLE                  208
-#define UNPACK_SEQUENCE_TWO_TUPLE              209
+#define BINARY_OP_INPLACE_ADD_INT              133
+#define BINARY_OP_INPLACE_SUBTRACT_INT         134
+#define BINARY_OP_MULTIPLY_FLOAT               135
+#define BINARY_OP_MULTIPLY_INT                 136
+#define BINARY_OP_SUBSCR_DICT                  137
+#define BINARY_OP_SUBSCR_GETITEM               138
+#define BINARY_OP_SUBSCR_LIST_INT              139
+#define BINARY_OP_SUBSCR_LIST_SLICE            140
+#define BINARY_OP_SUBSCR_STR_INT               141
+#define BINARY_OP_SUBSCR_TUPLE_INT             142
+#define BINARY_OP_SUBTRACT_FLOAT               143
+#define BINARY_OP_SUBTRACT_INT                 144
+#define CALL_ALLOC_AND_ENTER_INIT              145
+#define CALL_BOUND_METHOD_EXACT_ARGS           146
+#define CALL_BOUND_METHOD_GENERAL              147
+#define CALL_BUILTIN_CLASS                     148
+#define CALL_BUILTIN_FAST                      149
+#define CALL_BUILTIN_FAST_WITH_KEYWORDS        150
+#define CALL_BUILTIN_O                         151
+#define CALL_ISINSTANCE                        152
+#define CALL_KW_BOUND_METHOD                   153
+#define CALL_KW_NON_PY                         154
+#define CALL_KW_PY                             155
+#define CALL_LEN                               156
+#define CALL_LIST_APPEND                       157
+#define CALL_METHOD_DESCRIPTOR_FAST            158
+#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 159
+#define CALL_METHOD_DESCRIPTOR_NOARGS          160
+#define CALL_METHOD_DESCRIPTOR_O               161
+#define CALL_NON_PY_GENERAL                    162
+#define CALL_PY_EXACT_ARGS                     163
+#define CALL_PY_GENERAL                        164
+#define CALL_STR_1                             165
+#define CALL_TUPLE_1                           166
+#define CALL_TYPE_1                            167
+#define COMPARE_OP_FLOAT                       168
+#define COMPARE_OP_INT                         169
+#define COMPARE_OP_STR                         170
+#define CONTAINS_OP_DICT                       171
+#define CONTAINS_OP_SET                        172
+#define FOR_ITER_GEN                           173
+#define FOR_ITER_LIST                          174
+#define FOR_ITER_RANGE                         175
+#define FOR_ITER_TUPLE                         176
+#define JUMP_BACKWARD_JIT                      177
+#define JUMP_BACKWARD_NO_JIT                   178
+#define LOAD_ATTR_CLASS                        179
+#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   180
+#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      181
+#define LOAD_ATTR_INSTANCE_VALUE               182
+#define LOAD_ATTR_METHOD_LAZY_DICT             183
+#define LOAD_ATTR_METHOD_NO_DICT               184
+#define LOAD_ATTR_METHOD_WITH_VALUES           185
+#define LOAD_ATTR_MODULE                       186
+#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        187
+#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    188
+#define LOAD_ATTR_PROPERTY                     189
+#define LOAD_ATTR_SLOT                         190
+#define LOAD_ATTR_WITH_HINT                    191
+#define LOAD_GLOBAL_BUILTIN                    192
+#define LOAD_GLOBAL_MODULE                     193
+#define LOAD_SUPER_ATTR_ATTR                   194
+#define LOAD_SUPER_ATTR_METHOD                 195
+#define RESUME_CHECK                           196
+#define SEND_GEN                               197
+#define STORE_ATTR_INSTANCE_VALUE              198
+#define STORE_ATTR_SLOT                        199
+#define STORE_ATTR_WITH_HINT                   200
+#define STORE_SUBSCR_DICT                      201
+#define STORE_SUBSCR_LIST_INT                  202
+#define TO_BOOL_ALWAYS_TRUE                    203
+#define TO_BOOL_BOOL                           204
+#define TO_BOOL_INT                            205
+#define TO_BOOL_LIST                           206
+#define TO_BOOL_NONE                           207
+#define TO_BOOL_STR                            208
+#define UNPACK_SEQUENCE_LIST                   209
+#define UNPACK_SEQUENCE_TUPLE                  210
+#define UNPACK_SEQUENCE_TWO_TUPLE              211
 #define INSTRUMENTED_END_FOR                   233
 #define INSTRUMENTED_POP_ITER                  234
 #define INSTRUMENTED_END_SEND                  235
@@ -30,6 +30,8 @@ _specializations = {
         "BINARY_OP_SUBSCR_GETITEM",
         "BINARY_OP_EXTEND",
         "BINARY_OP_INPLACE_ADD_UNICODE",
+        "BINARY_OP_INPLACE_ADD_INT",
+        "BINARY_OP_INPLACE_SUBTRACT_INT",
     ],
     "STORE_SUBSCR": [
         "STORE_SUBSCR_DICT",
@@ -124,84 +126,86 @@ _specialized_opmap = {
     'BINARY_OP_ADD_INT': 130,
     'BINARY_OP_ADD_UNICODE': 131,
     'BINARY_OP_EXTEND': 132,
+    'BINARY_OP_INPLACE_ADD_INT': 133,
     'BINARY_OP_INPLACE_ADD_UNICODE': 3,
-    'BINARY_OP_MULTIPLY_FLOAT': 133,
-    'BINARY_OP_MULTIPLY_INT': 134,
-    'BINARY_OP_SUBSCR_DICT': 135,
-    'BINARY_OP_SUBSCR_GETITEM': 136,
-    'BINARY_OP_SUBSCR_LIST_INT': 137,
-    'BINARY_OP_SUBSCR_LIST_SLICE': 138,
-    'BINARY_OP_SUBSCR_STR_INT': 139,
-    'BINARY_OP_SUBSCR_TUPLE_INT': 140,
-    'BINARY_OP_SUBTRACT_FLOAT': 141,
-    'BINARY_OP_SUBTRACT_INT': 142,
-    'CALL_ALLOC_AND_ENTER_INIT': 143,
-    'CALL_BOUND_METHOD_EXACT_ARGS': 144,
-    'CALL_BOUND_METHOD_GENERAL': 145,
-    'CALL_BUILTIN_CLASS': 146,
-    'CALL_BUILTIN_FAST': 147,
-    'CALL_BUILTIN_FAST_WITH_KEYWORDS': 148,
-    'CALL_BUILTIN_O': 149,
-    'CALL_ISINSTANCE': 150,
-    'CALL_KW_BOUND_METHOD': 151,
-    'CALL_KW_NON_PY': 152,
-    'CALL_KW_PY': 153,
-    'CALL_LEN': 154,
-    'CALL_LIST_APPEND': 155,
-    'CALL_METHOD_DESCRIPTOR_FAST': 156,
-    'CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS': 157,
-    'CALL_METHOD_DESCRIPTOR_NOARGS': 158,
-    'CALL_METHOD_DESCRIPTOR_O': 159,
-    'CALL_NON_PY_GENERAL': 160,
-    'CALL_PY_EXACT_ARGS': 161,
-    'CALL_PY_GENERAL': 162,
-    'CALL_STR_1': 163,
-    'CALL_TUPLE_1': 164,
-    'CALL_TYPE_1': 165,
-    'COMPARE_OP_FLOAT': 166,
-    'COMPARE_OP_INT': 167,
-    'COMPARE_OP_STR': 168,
-    'CONTAINS_OP_DICT': 169,
-    'CONTAINS_OP_SET': 170,
-    'FOR_ITER_GEN': 171,
-    'FOR_ITER_LIST': 172,
-    'FOR_ITER_RANGE': 173,
-    'FOR_ITER_TUPLE': 174,
-    'JUMP_BACKWARD_JIT': 175,
-    'JUMP_BACKWARD_NO_JIT': 176,
-    'LOAD_ATTR_CLASS': 177,
-    'LOAD_ATTR_CLASS_WITH_METACLASS_CHECK': 178,
-    'LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN': 179,
-    'LOAD_ATTR_INSTANCE_VALUE': 180,
-    'LOAD_ATTR_METHOD_LAZY_DICT': 181,
-    'LOAD_ATTR_METHOD_NO_DICT': 182,
-    'LOAD_ATTR_METHOD_WITH_VALUES': 183,
-    'LOAD_ATTR_MODULE': 184,
-    'LOAD_ATTR_NONDESCRIPTOR_NO_DICT': 185,
-    'LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES': 186,
-    'LOAD_ATTR_PROPERTY': 187,
-    'LOAD_ATTR_SLOT': 188,
-    'LOAD_ATTR_WITH_HINT': 189,
-    'LOAD_GLOBAL_BUILTIN': 190,
-    'LOAD_GLOBAL_MODULE': 191,
-    'LOAD_SUPER_ATTR_ATTR': 192,
-    'LOAD_SUPER_ATTR_METHOD': 193,
-    'RESUME_CHECK': 194,
-    'SEND_GEN': 195,
-    'STORE_ATTR_INSTANCE_VALUE': 196,
-    'STORE_ATTR_SLOT': 197,
-    'STORE_ATTR_WITH_HINT': 198,
-    'STORE_SUBSCR_DICT': 199,
-    'STORE_SUBSCR_LIST_INT': 200,
-    'TO_BOOL_ALWAYS_TRUE': 201,
-    'TO_BOOL_BOOL': 202,
-    'TO_BOOL_INT': 203,
-    'TO_BOOL_LIST': 204,
-    'TO_BOOL_NONE': 205,
-    'TO_BOOL_STR': 206,
-    'UNPACK_SEQUENCE_LIST': 207,
-    'UNPACK_SEQUENCE_TUPLE': 208,
-    'UNPACK_SEQUENCE_TWO_TUPLE': 209,
+    'BINARY_OP_INPLACE_SUBTRACT_INT': 134,
+    'BINARY_OP_MULTIPLY_FLOAT': 135,
+    'BINARY_OP_MULTIPLY_INT': 136,
+    'BINARY_OP_SUBSCR_DICT': 137,
+    'BINARY_OP_SUBSCR_GETITEM': 138,
+    'BINARY_OP_SUBSCR_LIST_INT': 139,
+    'BINARY_OP_SUBSCR_LIST_SLICE': 140,
+    'BINARY_OP_SUBSCR_STR_INT': 141,
+    'BINARY_OP_SUBSCR_TUPLE_INT': 142,
+    'BINARY_OP_SUBTRACT_FLOAT': 143,
+    'BINARY_OP_SUBTRACT_INT': 144,
+    'CALL_ALLOC_AND_ENTER_INIT': 145,
+    'CALL_BOUND_METHOD_EXACT_ARGS': 146,
+    'CALL_BOUND_METHOD_GENERAL': 147,
+    'CALL_BUILTIN_CLASS': 148,
+    'CALL_BUILTIN_FAST': 149,
+    'CALL_BUILTIN_FAST_WITH_KEYWORDS': 150,
+    'CALL_BUILTIN_O': 151,
+    'CALL_ISINSTANCE': 152,
+    'CALL_KW_BOUND_METHOD': 153,
+    'CALL_KW_NON_PY': 154,
+    'CALL_KW_PY': 155,
+    'CALL_LEN': 156,
+    'CALL_LIST_APPEND': 157,
+    'CALL_METHOD_DESCRIPTOR_FAST': 158,
+    'CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS': 159,
+    'CALL_METHOD_DESCRIPTOR_NOARGS': 160,
+    'CALL_METHOD_DESCRIPTOR_O': 161,
+    'CALL_NON_PY_GENERAL': 162,
+    'CALL_PY_EXACT_ARGS': 163,
+    'CALL_PY_GENERAL': 164,
+    'CALL_STR_1': 165,
+    'CALL_TUPLE_1': 166,
+    'CALL_TYPE_1': 167,
+    'COMPARE_OP_FLOAT': 168,
+    'COMPARE_OP_INT': 169,
+    'COMPARE_OP_STR': 170,
+    'CONTAINS_OP_DICT': 171,
+    'CONTAINS_OP_SET': 172,
+    'FOR_ITER_GEN': 173,
+    'FOR_ITER_LIST': 174,
+    'FOR_ITER_RANGE': 175,
+    'FOR_ITER_TUPLE': 176,
+    'JUMP_BACKWARD_JIT': 177,
+    'JUMP_BACKWARD_NO_JIT': 178,
+    'LOAD_ATTR_CLASS': 179,
+    'LOAD_ATTR_CLASS_WITH_METACLASS_CHECK': 180,
+    'LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN': 181,
+    'LOAD_ATTR_INSTANCE_VALUE': 182,
+    'LOAD_ATTR_METHOD_LAZY_DICT': 183,
+    'LOAD_ATTR_METHOD_NO_DICT': 184,
+    'LOAD_ATTR_METHOD_WITH_VALUES': 185,
+    'LOAD_ATTR_MODULE': 186,
+    'LOAD_ATTR_NONDESCRIPTOR_NO_DICT': 187,
+    'LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES': 188,
+    'LOAD_ATTR_PROPERTY': 189,
+    'LOAD_ATTR_SLOT': 190,
+    'LOAD_ATTR_WITH_HINT': 191,
+    'LOAD_GLOBAL_BUILTIN': 192,
+    'LOAD_GLOBAL_MODULE': 193,
+    'LOAD_SUPER_ATTR_ATTR': 194,
+    'LOAD_SUPER_ATTR_METHOD': 195,
+    'RESUME_CHECK': 196,
+    'SEND_GEN': 197,
+    'STORE_ATTR_INSTANCE_VALUE': 198,
+    'STORE_ATTR_SLOT': 199,
+    'STORE_ATTR_WITH_HINT': 200,
+    'STORE_SUBSCR_DICT': 201,
+    'STORE_SUBSCR_LIST_INT': 202,
+    'TO_BOOL_ALWAYS_TRUE': 203,
+    'TO_BOOL_BOOL': 204,
+    'TO_BOOL_INT': 205,
+    'TO_BOOL_LIST': 206,
+    'TO_BOOL_NONE': 207,
+    'TO_BOOL_STR': 208,
+    'UNPACK_SEQUENCE_LIST': 209,
+    'UNPACK_SEQUENCE_TUPLE': 210,
+    'UNPACK_SEQUENCE_TWO_TUPLE': 211,
 }
 
 opmap = {
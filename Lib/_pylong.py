@@ -1,16 +1,16 @@
-"""Python implementations of some algorithms for use by longobject.c.
+"""Python implementations of some algorithms for integers with many digits.
 The goal is to provide asymptotically faster algorithms that can be
-used for operations on integers with many digits.  In those cases, the
-performance overhead of the Python implementation is not significant
-since the asymptotic behavior is what dominates runtime. Functions
-provided by this module should be considered private and not part of any
-public API.
+used for operations on integers with many digits.  longobject.c used to
+call them for the conversions between int and str and for division; it
+now implements the same divide-and-conquer and Burnikel-Ziegler algorithms
+natively, and this module serves as their reference implementation.
+Functions provided by this module should be considered private and not
+part of any public API.
 
 Note: for ease of maintainability, please prefer clear code and avoid
-"micro-optimizations".  This module will only be imported and used for
-integers with a huge number of digits.  Saving a few microseconds with
-tricky or non-obvious code is not worth it.  For people looking for
-maximum performance, they should use something like gmpy2."""
+"micro-optimizations".  Saving a few microseconds with tricky or
+non-obvious code is not worth it.  For people looking for maximum
+performance, they should use something like gmpy2."""
 
 import re
 import decimal
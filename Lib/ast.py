@@ -24,15 +24,19 @@
 
 
 def parse(source, filename='<unknown>', mode='exec', *,
-          type_comments=False, feature_version=None, optimize=-1, module=None):
+          type_comments=False, feature_version=None, optimize=-1, module=None,
+          lazy=False):
     """
     Parse the source into an AST node.
     Equivalent to compile(source, filename, mode, PyCF_ONLY_AST).
     Pass type_comments=True to get back type comments where the syntax allows.
+    Pass lazy=True to convert the fields of each node on first access.
     """
     flags = PyCF_ONLY_AST
     if optimize > 0:
         flags |= PyCF_OPTIMIZED_AST
+    if lazy:
+        flags |= PyCF_LAZY_AST
     if type_comments:
         flags |= PyCF_TYPE_COMMENTS
     if feature_version is None:
@@ -24,21 +24,30 @@
     the instance 'remembers' and compiles all subsequent program texts
     with the statement in force.
 
-The module also provides another class:
+The module also provides other classes:
 
 Compile():
 
     Instances of this class act like the built-in function compile,
     but with 'memory' in the sense described above.
+
+CompileCache():
+
+    Instances of this class act like the built-in function compile,
+    but return the code object of a previous call with the same
+    arguments instead of compiling the source again.
 """
 
 import __future__
+import marshal
+import os
+import sys
 import warnings
 
 _features = [getattr(__future__, fname)
              for fname in __future__.all_feature_names]
 
-__all__ = ["compile_command", "Compile", "CommandCompiler"]
+__all__ = ["compile_command", "Compile", "CommandCompiler", "CompileCache"]
 
 # The following flags match the values from Include/cpython/compile.h
 # Caveat emptor: These flags are undocumented on purpose and depending
@@ -152,3 +161,82 @@ def __call__(self, source, filename="<input>", symbol="single"):
           malformed literals).
         """
         return _maybe_compile(self.compiler, source, filename, symbol, flags=self.compiler.flags)
+
+
+class CompileCache:
+    """Instances of this class behave much like the built-in compile
+    function, but the code objects are cached.  Compiling the same source
+    with the same arguments again returns the cached code object.
+
+    The maxsize most recently used code objects are kept in memory.  If
+    directory is given, code objects are also stored there, so that other
+    processes can reuse them."""
+
+    def __init__(self, maxsize=128, directory=None):
+        if maxsize < 0:
+            raise ValueError("maxsize must be non-negative")
+        self.maxsize = maxsize
+        self.directory = directory
+        self._cache = {}
+
+    def __call__(self, source, filename, mode, flags=0, optimize=-1):
+        if not isinstance(source, (str, bytes)) or flags & PyCF_ONLY_AST:
+            return compile(source, filename, mode, flags, True, optimize)
+        if optimize == -1:
+            # The code is shared with processes using other -O options.
+            optimize = sys.flags.optimize
+        key = (source, os.fspath(filename), mode, flags, optimize)
+        # Move the key to the end of the dict, which is kept in LRU order.
+        code = self._cache.pop(key, None)
+        if code is None:
+            if self.directory is not None:
+                code = self._load(key)
+            if code is None:
+                code = compile(source, filename, mode, flags, True, optimize)
+                if self.directory is not None:
+                    self._store(key, code)
+        if self.maxsize:
+            self._cache[key] = code
+            if len(self._cache) > self.maxsize:
+                del self._cache[next(iter(self._cache))]
+        return code
+
+    def clear(self):
+        """Clear the in-memory cache."""
+        self._cache.clear()
+
+    def _path(self, key):
+        from importlib.util import source_hash
+        key = repr(key).encode('utf-8', 'surrogatepass')
+        path = os.path.join(self.directory, source_hash(key).hex() + '.pyc')
+        return path, key
+
+    def _load(self, key):
+        from importlib.util import MAGIC_NUMBER
+        path, key = self._path(key)
+        try:
+            with open(path, 'rb') as file:
+                data = file.read()
+        except OSError:
+            return None
+        if data[:4] != MAGIC_NUMBER:
+            return None
+        try:
+            stored_key, code = marshal.loads(memoryview(data)[4:])
+        except (EOFError, ValueError, TypeError):
+            return None
+        # Different keys can have the same hash.
+        if stored_key != key:
+            return None
+        return code
+
+    def _store(self, key, code):
+        from importlib._bootstrap_external import _write_atomic
+        from importlib.util import MAGIC_NUMBER
+        path, key = self._path(key)
+        try:
+            os.makedirs(self.directory, exist_ok=True)
+            _write_atomic(path, MAGIC_NUMBER + marshal.dumps((key, code)))
+        except OSError:
+            # The cache is only an optimization.
+            pass
@@ -1,13 +1,59 @@
 """Implements InterpreterPoolExecutor."""
 
 from concurrent import interpreters
+import importlib
 import sys
 from . import thread as _thread
 import traceback
 
 
+# The callables that were sent by reference, keyed by reference.
+# Each worker interpreter has its own copy of this module, thus its own
+# cache, so a callable is only imported once per worker.
+_callables = {}
+
+
+def _get_callable_ref(func):
+    """Return a (module name, qualified name) reference to func.
+
+    None is returned if func cannot be found again under that name,
+    in which case the callable itself must be sent.
+    """
+    modname = getattr(func, '__module__', None)
+    qualname = getattr(func, '__qualname__', None)
+    if (not isinstance(modname, str) or not isinstance(qualname, str)
+            or modname == '__main__' or '<' in qualname):
+        return None
+    try:
+        obj = sys.modules[modname]
+        for name in qualname.split('.'):
+            obj = getattr(obj, name)
+    except (KeyError, AttributeError):
+        return None
+    if obj is not func:
+        return None
+    return (modname, qualname)
+
+
+def _resolve_callable(ref):
+    try:
+        return _callables[ref]
+    except KeyError:
+        pass
+    modname, qualname = ref
+    obj = importlib.import_module(modname)
+    for name in qualname.split('.'):
+        obj = getattr(obj, name)
+    _callables[ref] = obj
+    return obj
+
+
 def do_call(results, func, args, kwargs):
     try:
+        if type(func) is tuple:
+            func = _resolve_callable(func)
+        if kwargs is None:
+            return func(*args)
         return func(*args, **kwargs)
     except BaseException as exc:
         # Send the captured exception out on the results queue,
@@ -30,9 +76,12 @@ def resolve_task(fn, args, kwargs):
             if isinstance(fn, str):
                 # XXX Circle back to this later.
                 raise TypeError('scripts not supported')
-            else:
-                task = (fn, args, kwargs)
-            return task
+            # Module-level functions are sent by name, instead of being
+            # pickled for every call, and empty kwargs are not sent at all.
+            ref = _get_callable_ref(fn)
+            if ref is not None:
+                fn = ref
+            return (fn, args, kwargs or None)
 
         if initializer is not None:
             try:
@@ -6,6 +6,7 @@
 __author__ = 'Brian Quinlan (brian@sweetapp.com)'
 
 from concurrent.futures import _base
+import functools
 import itertools
 import queue
 import threading
@@ -196,16 +197,21 @@ def __init__(self, max_workers=None, thread_name_prefix='',
         self._thread_name_prefix = (thread_name_prefix or
                                     ("ThreadPoolExecutor-%d" % self._counter()))
 
+    def _check_can_submit(self):
+        # Must be called with self._shutdown_lock and _global_shutdown_lock
+        # held.
+        if self._broken:
+            raise self.BROKEN(self._broken)
+
+        if self._shutdown:
+            raise RuntimeError('cannot schedule new futures after shutdown')
+        if _shutdown:
+            raise RuntimeError('cannot schedule new futures after '
+                               'interpreter shutdown')
+
     def submit(self, fn, /, *args, **kwargs):
         with self._shutdown_lock, _global_shutdown_lock:
-            if self._broken:
-                raise self.BROKEN(self._broken)
-
-            if self._shutdown:
-                raise RuntimeError('cannot schedule new futures after shutdown')
-            if _shutdown:
-                raise RuntimeError('cannot schedule new futures after '
-                                   'interpreter shutdown')
+            self._check_can_submit()
 
             f = _base.Future()
             task = self._resolve_work_item_task(fn, args, kwargs)
@@ -216,6 +222,71 @@ def submit(self, fn, /, *args, **kwargs):
             return f
     submit.__doc__ = _base.Executor.submit.__doc__
 
+    def submit_many(self, fn, iterable, /):
+        """Submits fn(*args) for each args in iterable.
+
+        This is equivalent to ``[self.submit(fn, *args) for args in
+        iterable]``, but the executor locks are taken only once for the
+        whole batch, which makes submitting many small tasks cheaper.
+
+        Returns:
+            A list of Futures, one for each submitted call, in the order of
+            the iterable.
+        """
+        # Resolve the tasks before taking the locks: consuming the iterable
+        # may run arbitrary code.
+        tasks = [self._resolve_work_item_task(fn, tuple(args), {})
+                 for args in iterable]
+        with self._shutdown_lock, _global_shutdown_lock:
+            self._check_can_submit()
+
+            fs = []
+            for task in tasks:
+                f = _base.Future()
+                self._work_queue.put(_WorkItem(f, task))
+                fs.append(f)
+                if len(self._threads) < self._max_workers:
+                    self._adjust_thread_count()
+            return fs
+
+    def map(self, fn, *iterables, timeout=None, chunksize=1, buffersize=None):
+        """Returns an iterator equivalent to map(fn, iter).
+
+        Args:
+            fn: A callable that will take as many arguments as there are
+                passed iterables.
+            timeout: The maximum number of seconds to wait. If None, then there
+                is no limit on the wait time.
+            chunksize: If greater than one, the iterables will be chopped into
+                chunks of size chunksize and each chunk is run as a single
+                task, which avoids creating a Future per call.
+            buffersize: The number of submitted tasks whose results have not
+                yet been yielded. If the buffer is full, iteration over the
+                iterables pauses until a result is yielded from the buffer.
+                If None, all input elements are eagerly collected, and a task is
+                submitted for each.
+
+        Returns:
+            An iterator equivalent to: map(func, *iterables) but the calls may
+            be evaluated out-of-order.
+
+        Raises:
+            TimeoutError: If the entire result iterator could not be generated
+                before the given timeout.
+            Exception: If fn(*args) raises for any values.
+        """
+        if chunksize < 1:
+            raise ValueError("chunksize must be >= 1.")
+        if chunksize == 1:
+            return super().map(fn, *iterables, timeout=timeout,
+                               buffersize=buffersize)
+
+        results = super().map(functools.partial(_base._process_chunk, fn),
+                              itertools.batched(zip(*iterables), chunksize),
+                              timeout=timeout,
+                              buffersize=buffersize)
+        return _base._chain_from_iterable_of_lists(results)
+
     def _adjust_thread_count(self):
         # if idle threads are available, don't spin new threads
         if self._idle_semaphore.acquire(timeout=0):
@@ -1,7 +1,6 @@
 """Cross-interpreter Queues High Level Module."""
 
 import queue
-import time
 import weakref
 import _interpqueues as _queues
 from . import _crossinterp
@@ -172,7 +171,6 @@ def qsize(self):
 
     def put(self, obj, block=True, timeout=None, *,
             unbounditems=None,
-            _delay=10 / 1000,  # 10 milliseconds
             ):
         """Add the object to the queue.
 
@@ -211,35 +209,35 @@ def put(self, obj, block=True, timeout=None, *,
         """
         if not block:
             return self.put_nowait(obj, unbounditems=unbounditems)
-        if unbounditems is None:
-            unboundop = -1
-        else:
-            unboundop, = _serialize_unbound(unbounditems)
-        if timeout is not None:
-            timeout = int(timeout)
-            if timeout < 0:
-                raise ValueError(f'timeout value must be non-negative')
-            end = time.time() + timeout
-        while True:
-            try:
-                _queues.put(self._id, obj, unboundop)
-            except QueueFull:
-                if timeout is not None and time.time() >= end:
-                    raise  # re-raise
-                time.sleep(_delay)
-            else:
-                break
+        unboundop = self._resolve_unboundop(unbounditems)
+        _queues.put(self._id, obj, unboundop, blocking=True, timeout=timeout)
 
     def put_nowait(self, obj, *, unbounditems=None):
-        if unbounditems is None:
-            unboundop = -1
-        else:
-            unboundop, = _serialize_unbound(unbounditems)
+        unboundop = self._resolve_unboundop(unbounditems)
         _queues.put(self._id, obj, unboundop)
 
-    def get(self, block=True, timeout=None, *,
-            _delay=10 / 1000,  # 10 milliseconds
-            ):
+    def put_many(self, objs, block=True, timeout=None, *,
+                 unbounditems=None):
+        """Add each object of the iterable to the queue, in order.
+
+        This is equivalent to calling put() for each object, with the same
+        arguments, but it is faster.  If put() fails (e.g. QueueFull is
+        raised when the timeout expires), the objects before it stay in
+        the queue.
+        """
+        unboundop = self._resolve_unboundop(unbounditems)
+        if not block:
+            timeout = None
+        _queues.put_many(self._id, objs, unboundop,
+                         blocking=block, timeout=timeout)
+
+    def _resolve_unboundop(self, unbounditems):
+        if unbounditems is None:
+            return -1
+        unboundop, = _serialize_unbound(unbounditems)
+        return unboundop
+
+    def get(self, block=True, timeout=None):
         """Return the next object from the queue.
 
         If "block" is true, this blocks while the queue is empty.
@@ -250,20 +248,7 @@ def get(self, block=True, timeout=None, *,
         """
         if not block:
             return self.get_nowait()
-        if timeout is not None:
-            timeout = int(timeout)
-            if timeout < 0:
-                raise ValueError(f'timeout value must be non-negative')
-            end = time.time() + timeout
-        while True:
-            try:
-                obj, unboundop = _queues.get(self._id)
-            except QueueEmpty:
-                if timeout is not None and time.time() >= end:
-                    raise  # re-raise
-                time.sleep(_delay)
-            else:
-                break
+        obj, unboundop = _queues.get(self._id, blocking=True, timeout=timeout)
         if unboundop is not None:
             assert obj is None, repr(obj)
             return _resolve_unbound(unboundop)
@@ -284,5 +269,18 @@ def get_nowait(self):
             return _resolve_unbound(unboundop)
         return obj
 
+    def get_many(self, maxitems, block=True, timeout=None):
+        """Return a list of up to "maxitems" objects from the queue.
+
+        The first object is returned like get() does, then the list is
+        completed with the objects that are available without waiting.
+        """
+        if not block:
+            timeout = None
+        items = _queues.get_many(self._id, maxitems,
+                                 blocking=block, timeout=timeout)
+        return [obj if unboundop is None else _resolve_unbound(unboundop)
+                for obj, unboundop in items]
+
 
 _queues._register_heap_types(Queue, QueueEmpty, QueueFull)
@@ -506,9 +506,21 @@ def _validate_hash_pyc(data, source_hash, name, exc_details):
         )
 
 
+# Code objects unmarshalled ahead of time by importlib.util.prefetch(),
+# keyed by bytecode path.  Values are (data, code) pairs; the code is only
+# used if the pyc still holds the same data.  At most _PREFETCH_LIMIT entries
+# are kept; entries are dropped when the module is loaded.
+_prefetched_code = {}
+_PREFETCH_LIMIT = 1000
+
+
 def _compile_bytecode(data, name=None, bytecode_path=None, source_path=None):
     """Compile bytecode as found in a pyc."""
-    code = marshal.loads(data)
+    prefetched = _prefetched_code.pop(bytecode_path, None)
+    if prefetched is not None and prefetched[0] == data:
+        code = prefetched[1]
+    else:
+        code = marshal.loads(data)
     if isinstance(code, _code_type):
         _bootstrap._verbose_message('code object from {!r}', bytecode_path)
         if source_path is not None:
@@ -1202,6 +1214,7 @@ def invalidate_caches():
         # Also invalidate the caches of NamespacePaths
         # https://bugs.python.org/issue45703
         NamespacePath._epoch += 1
+        _prefetched_code.clear()
 
         from importlib.metadata import MetadataPathFinder
         MetadataPathFinder.invalidate_caches()
@@ -1308,6 +1321,166 @@ def find_distributions(*args, **kwargs):
         return MetadataPathFinder.find_distributions(*args, **kwargs)
 
 
+class _DirectoryIndex:
+
+    """Persistent index of directory listings, shared between processes.
+
+    It is enabled by setting PYTHONIMPORTDIRCACHE to the path of the index
+    file.  A directory is listed again only if its mtime changed.  The site
+    module also keeps the contents of .pth files in it.
+
+    """
+
+    _MAGIC = b'PyDirIndex\x01\r\n'
+    # A listing taken shortly after the directory was modified could miss
+    # files created later within the same mtime tick, so it is not saved.
+    # The same goes for the contents of files.
+    _RACY_NS = 2_000_000_000
+
+    # At most this many entries are kept in the file.  The ones least
+    # recently used by a process that wrote the file are dropped first.
+    _MAX_ENTRIES = 5000
+
+    _index = None
+
+    def __init__(self, path):
+        self.path = path
+        self._entries = self._load()
+        # Paths recorded, used and forgotten by this process.  save() applies
+        # them to the file as it is then, which may have been written by
+        # other processes in the meantime.
+        self._recorded = {}
+        self._used = {}
+        self._forgotten = set()
+        self._changed = False
+
+    def _load(self):
+        try:
+            with _io.FileIO(self.path, 'r') as file:
+                data = file.read()
+        except OSError:
+            return {}
+        if data.startswith(self._MAGIC):
+            try:
+                entries = marshal.loads(memoryview(data)[len(self._MAGIC):],
+                                        allow_code=False)
+            except (EOFError, ValueError, TypeError):
+                return {}
+            if type(entries) is dict:
+                return entries
+        return {}
+
+    def listdir(self, path, mtime=None):
+        """Return the contents of the directory, from the index if possible.
+
+        mtime is the st_mtime_ns of the directory, if it is already known.
+
+        """
+        if mtime is None:
+            mtime = _path_stat(path).st_mtime_ns
+        entry = self._entries.get(path)
+        if entry is not None and entry[0] == mtime and type(entry[1]) is tuple:
+            self._used[path] = None
+            return entry[1]
+        contents = _os.listdir(path)
+        self._record(path, mtime, tuple(contents))
+        return contents
+
+    def read(self, path, st):
+        """Return the contents of the file, from the index if possible.
+
+        st is the result of stat() on the file.
+
+        """
+        mtime = st.st_mtime_ns
+        entry = self._entries.get(path)
+        if (entry is not None and entry[0] == mtime and
+                type(entry[1]) is bytes and len(entry[1]) == st.st_size):
+            self._used[path] = None
+            return entry[1]
+        with _io.open_code(path) as file:
+            data = file.read()
+        self._record(path, mtime, data)
+        return data
+
+    def forget(self, path):
+        if self._entries.pop(path, None) is not None:
+            self._recorded.pop(path, None)
+            self._used.pop(path, None)
+            self._forgotten.add(path)
+            self._changed = True
+
+    def _record(self, path, mtime, contents):
+        import time  # To avoid bootstrap issues.
+        if time.time_ns() - mtime > self._RACY_NS:
+            entry = (mtime, contents)
+            self._entries[path] = entry
+            self._recorded[path] = entry
+            self._used[path] = None
+            self._forgotten.discard(path)
+            self._changed = True
+
+    def save(self):
+        """Write the index file if the index changed.
+
+        It is called at exit, so that the file is written at most once
+        per process.  The changes are merged with the current contents of
+        the file, and the least recently used entries are dropped if there
+        are more than _MAX_ENTRIES.
+
+        """
+        if not self._changed:
+            return
+        self._changed = False
+        entries = self._load()
+        for path in self._forgotten:
+            entries.pop(path, None)
+        # Move the entries used by this process to the end.
+        for path in self._used:
+            entry = self._recorded.get(path)
+            if entry is None:
+                entry = entries.pop(path, None) or self._entries.get(path)
+            else:
+                entries.pop(path, None)
+            if entry is not None:
+                entries[path] = entry
+        excess = len(entries) - self._MAX_ENTRIES
+        if excess > 0:
+            for path in list(entries)[:excess]:
+                del entries[path]
+        self._entries = entries
+        self._recorded.clear()
+        self._used.clear()
+        self._forgotten.clear()
+        data = self._MAGIC + marshal.dumps(entries)
+        try:
+            _write_atomic(self.path, data)
+        except OSError:
+            # The index is only an optimization.
+            pass
+
+    @classmethod
+    def _get(cls):
+        """Return the index, or None if it is disabled."""
+        index = cls._index
+        if index is None:
+            index = False
+            if not sys.flags.ignore_environment:
+                if _MS_WINDOWS:
+                    path = _os.environ.get('PYTHONIMPORTDIRCACHE')
+                else:
+                    path = _os.environ.get(b'PYTHONIMPORTDIRCACHE')
+                if path:
+                    if isinstance(path, bytes):
+                        path = path.decode(sys.getfilesystemencoding(),
+                                           'surrogateescape')
+                    index = cls(path)
+                    import atexit  # To avoid bootstrap issues.
+                    atexit.register(index.save)
+            cls._index = index
+        return index or None
+
+
 class FileFinder:
 
     """File-based finder.
@@ -1337,6 +1510,9 @@ def __init__(self, path, *loader_details):
     def invalidate_caches(self):
         """Invalidate the directory mtime."""
         self._path_mtime = -1
+        index = _DirectoryIndex._get()
+        if index is not None:
+            index.forget(self.path or _os.getcwd())
 
     def _get_spec(self, loader_class, fullname, path, smsl, target):
         loader = loader_class(fullname, path)
@@ -1351,11 +1527,14 @@ def find_spec(self, fullname, target=None):
         is_namespace = False
         tail_module = fullname.rpartition('.')[2]
         try:
-            mtime = _path_stat(self.path or _os.getcwd()).st_mtime
+            st = _path_stat(self.path or _os.getcwd())
         except OSError:
+            st = None
             mtime = -1
+        else:
+            mtime = st.st_mtime
         if mtime != self._path_mtime:
-            self._fill_cache()
+            self._fill_cache(st)
             self._path_mtime = mtime
         # tail_module keeps the original casing, for __file__ and friends
         if _relax_case():
@@ -1394,11 +1573,20 @@ def find_spec(self, fullname, target=None):
             return spec
         return None
 
-    def _fill_cache(self):
-        """Fill the cache of potential modules and packages for this directory."""
-        path = self.path
+    def _fill_cache(self, st=None):
+        """Fill the cache of potential modules and packages for this directory.
+
+        st is the result of stat() on the directory, if it is already known.
+
+        """
+        path = self.path or _os.getcwd()
+        index = _DirectoryIndex._get()
         try:
-            contents = _os.listdir(path or _os.getcwd())
+            if index is None:
+                contents = _os.listdir(path)
+            else:
+                mtime = None if st is None else st.st_mtime_ns
+                contents = index.listdir(path, mtime)
         except (FileNotFoundError, PermissionError, NotADirectoryError):
             # Directory has either been removed, turned into a file, or made
             # unreadable.
@@ -1,16 +1,19 @@
 """Utility code for constructing importers, etc."""
+from . import _bootstrap_external
 from ._abc import Loader
 from ._bootstrap import module_from_spec
 from ._bootstrap import _resolve_name
 from ._bootstrap import spec_from_loader
 from ._bootstrap import _find_spec
 from ._bootstrap_external import MAGIC_NUMBER
+from ._bootstrap_external import _prefetched_code
 from ._bootstrap_external import cache_from_source
 from ._bootstrap_external import decode_source
 from ._bootstrap_external import source_from_cache
 from ._bootstrap_external import spec_from_file_location
 
 import _imp
+import marshal
 import sys
 import types
 
@@ -111,6 +114,63 @@ def find_spec(name, package=None):
             return spec
 
 
+def prefetch(paths, *, max_workers=1):
+    """Unmarshal the bytecode of modules on background threads.
+
+    The paths are the source files (or sourceless bytecode files) of the
+    modules, in the order they are expected to be imported.  The code objects
+    are used when the modules are imported if their bytecode files did not
+    change in the meantime; otherwise the files are loaded as usual.
+
+    At most 1000 code objects are kept until their module is imported;
+    the remaining paths are skipped.
+
+    Return the list of the started threads.
+
+    """
+    if max_workers <= 0:
+        raise ValueError("max_workers must be greater than 0")
+    import threading
+    paths = list(paths)
+    threads = []
+    for i in range(min(max_workers, len(paths))):
+        thread = threading.Thread(target=_prefetch,
+                                  args=(paths[i::max_workers],),
+                                  name=f'importlib-prefetch-{i}')
+        thread.start()
+        threads.append(thread)
+    return threads
+
+
+def _prefetch(paths):
+    for path in paths:
+        if len(_prefetched_code) >= _bootstrap_external._PREFETCH_LIMIT:
+            break
+        if path.endswith(tuple(_bootstrap_external.BYTECODE_SUFFIXES)):
+            bytecode_path = path
+        else:
+            try:
+                bytecode_path = cache_from_source(path)
+            except (NotImplementedError, ValueError):
+                continue
+        if bytecode_path in _prefetched_code:
+            continue
+        try:
+            with open(bytecode_path, 'rb') as file:
+                data = file.read()
+        except OSError:
+            continue
+        if data[:4] != MAGIC_NUMBER:
+            continue
+        data = data[16:]
+        try:
+            code = marshal.loads(data)
+        except (EOFError, ValueError, TypeError):
+            continue
+        if isinstance(code, types.CodeType):
+            _prefetched_code[bytecode_path] = (data, code)
+
+
 # Normally we would use contextlib.contextmanager.  However, this module
 # is imported by runpy, which means we want to avoid any unnecessary
 # dependencies.  Thus we use a class.
@@ -275,5 +335,5 @@ def exec_module(self, module):
 
 __all__ = ['LazyLoader', 'Loader', 'MAGIC_NUMBER',
            'cache_from_source', 'decode_source', 'find_spec',
-           'module_from_spec', 'resolve_name', 'source_from_cache',
+           'module_from_spec', 'prefetch', 'resolve_name', 'source_from_cache',
            'source_hash', 'spec_from_file_location', 'spec_from_loader']
@@ -165,6 +165,13 @@ def _init_pathinfo():
     return d
 
 
+def _get_dir_index():
+    """Return the persistent directory index of the path-based finder, or
+    None if it is disabled (see PYTHONIMPORTDIRCACHE)."""
+    import _frozen_importlib_external
+    return _frozen_importlib_external._DirectoryIndex._get()
+
+
 def addpackage(sitedir, name, known_paths):
     """Process a .pth file within the site-packages directory:
        For each line in the file, either combine it with sitedir to a path
@@ -185,9 +192,14 @@ def addpackage(sitedir, name, known_paths):
         _trace(f"Skipping hidden .pth file: {fullname!r}")
         return
     _trace(f"Processing .pth file: {fullname!r}")
+    index = _get_dir_index()
     try:
-        with io.open_code(fullname) as f:
-            pth_content = f.read()
+        if index is not None:
+            # The index needs the stat() of a symlinked file's target.
+            pth_content = index.read(fullname, os.stat(fullname))
+        else:
+            with io.open_code(fullname) as f:
+                pth_content = f.read()
     except OSError:
         return
 
@@ -244,8 +256,12 @@ def addsitedir(sitedir, known_paths=None):
     if not sitedircase in known_paths:
         sys.path.append(sitedir)        # Add path component
         known_paths.add(sitedircase)
+    index = _get_dir_index()
     try:
-        names = os.listdir(sitedir)
+        if index is not None:
+            names = index.listdir(sitedir)
+        else:
+            names = os.listdir(sitedir)
     except OSError:
         return
     names = [name for name in names
@@ -411,6 +411,38 @@ def test_find_shift_table_overflow(self):
         self.checkequal(len(text2) - N*len("de") - len(pattern2),
                         text2, 'find', pattern2)
 
+    def test_find_count_candidates(self):
+        # Cover the search which checks the first and last characters of
+        # the needle at many positions at once, in short and long strings.
+        for n in 40, 35_000:
+            filler = 'ab' * n
+            for m in 2, 3, 5, 6, 17, 32, 33:
+                needle = 'c' * (m - 1) + 'b'
+                # the first and last characters of 'a' + 'c' * (m - 2) + 'a'
+                # are at the same distance in the haystack for odd m
+                absent = 'a' + 'c' * (m - 2) + 'a'
+                for pos in (0, 1, 15, 16, 17, n // 2, n - m - 1, n - m):
+                    text = filler[:pos] + needle + filler[pos:n - m]
+                    with self.subTest(n=n, m=m, pos=pos):
+                        self.checkequal(pos, text, 'find', needle)
+                        self.checkequal(1, text, 'count', needle)
+                        self.checkequal(-1, text, 'find', needle, pos + 1)
+                        self.checkequal(-1, text, 'find', absent)
+                # non-overlapping matches
+                text = 'a' * n
+                self.checkequal(n // m, text, 'count', 'a' * m)
+                if 3 * m <= n:
+                    self.checkequal('xxx' + text[3 * m:],
+                                    text, 'replace', 'a' * m, 'x', 3)
+
+        # Many candidates that are not matches: keep O(n + m) time.
+        N = 100_000
+        for m in 3, 20:
+            needle = 'a' * (m // 2) + 'b' + 'a' * (m // 2)
+            self.checkequal(-1, 'a' * N, 'find', needle)
+            self.checkequal(N, 'a' * N + needle, 'find', needle)
+            self.checkequal(1, 'a' * N + needle, 'count', needle)
+
     def test_lower(self):
         self.checkequal('hello', 'HeLLo', 'lower')
         self.checkequal('hello', 'hello', 'lower')
@@ -1449,6 +1449,49 @@ def test_parse(self):
         b = compile('foo(1 + 1)', '<unknown>', 'exec', ast.PyCF_ONLY_AST)
         self.assertEqual(ast.dump(a), ast.dump(b))
 
+    def test_parse_lazy(self):
+        for fn in STDLIB_FILES[:10]:
+            with open(os.path.join(STDLIB, fn), encoding="utf-8") as fp:
+                source = fp.read()
+            with self.subTest(fn=fn):
+                self.assertEqual(
+                    ast.dump(ast.parse(source, lazy=True), include_attributes=True),
+                    ast.dump(ast.parse(source), include_attributes=True))
+
+        for mode, source in [('eval', 'a.b + c[d]'), ('single', 'x = 1'),
+                             ('func_type', '(int, str) -> None')]:
+            with self.subTest(mode=mode):
+                self.assertEqual(ast.dump(ast.parse(source, mode=mode, lazy=True)),
+                                 ast.dump(ast.parse(source, mode=mode)))
+
+    def test_parse_lazy_partial_access(self):
+        tree = ast.parse('def f(x):\n    return x + 1\ny = f(2)\n', lazy=True)
+        second = tree.body[1]
+        self.assertIsInstance(second, ast.Assign)
+        self.assertEqual(second.lineno, 3)
+        self.assertEqual(second.targets[0].id, 'y')
+        # Nodes which were never accessed are still converted correctly.
+        func = tree.body[0]
+        self.assertEqual(ast.unparse(func), 'def f(x):\n    return x + 1')
+        # Setting a field before any read keeps the other fields.
+        tree = ast.parse('a = b', lazy=True)
+        node = tree.body[0]
+        node.value = ast.Name('c')
+        self.assertEqual(ast.unparse(node), 'a = c')
+        del tree
+        self.assertEqual(node.targets[0].id, 'a')
+
+    def test_parse_lazy_compile(self):
+        tree = ast.parse('x = 6 * 7', lazy=True)
+        ns = {}
+        exec(compile(tree, '<lazy>', 'exec'), ns)
+        self.assertEqual(ns['x'], 42)
+        a = compile('x = 6 * 7', '<lazy>', 'exec', ast.PyCF_LAZY_AST)
+        b = compile(ast.parse('x = 6 * 7'), '<lazy>', 'exec', ast.PyCF_LAZY_AST)
+        self.assertEqual(ast.dump(a), ast.dump(b))
+        self.assertEqual(ast.dump(copy.deepcopy(ast.parse('f(x)', lazy=True))),
+                         ast.dump(ast.parse('f(x)')))
+
     def test_parse_in_error(self):
         try:
             1/0
@@ -302,7 +302,7 @@ def testfunc(n):
         uops = get_opnames(ex)
         # Since there is no JUMP_FORWARD instruction,
         # look for indirect evidence: the += operator
-        self.assertIn("_BINARY_OP_ADD_INT", uops)
+        self.assertIn("_BINARY_OP_INPLACE_ADD_INT", uops)
 
     def test_for_iter_range(self):
         def testfunc(n):
@@ -459,7 +459,8 @@ def testfunc(loops):
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
         self.assertEqual(res, (TIER2_THRESHOLD - 1) * 2 + 1)
-        binop_count = [opname for opname in iter_opnames(ex) if opname == "_BINARY_OP_ADD_INT"]
+        binop_count = [opname for opname in iter_opnames(ex)
+                       if opname in ("_BINARY_OP_ADD_INT", "_BINARY_OP_INPLACE_ADD_INT")]
         guard_tos_int_count = [opname for opname in iter_opnames(ex) if opname == "_GUARD_TOS_INT"]
         guard_nos_int_count = [opname for opname in iter_opnames(ex) if opname == "_GUARD_NOS_INT"]
         self.assertGreaterEqual(len(binop_count), 3)
@@ -482,7 +483,8 @@ def testfunc(loops):
         ex = get_first_executor(testfunc)
         self.assertIsNotNone(ex)
         self.assertEqual(res, (TIER2_THRESHOLD - 1) * 4)
-        binop_count = [opname for opname in iter_opnames(ex) if opname == "_BINARY_OP_ADD_INT"]
+        binop_count = [opname for opname in iter_opnames(ex)
+                       if opname in ("_BINARY_OP_ADD_INT", "_BINARY_OP_INPLACE_ADD_INT")]
         guard_tos_int_count = [opname for opname in iter_opnames(ex) if opname == "_GUARD_TOS_INT"]
         guard_nos_int_count = [opname for opname in iter_opnames(ex) if opname == "_GUARD_NOS_INT"]
         self.assertGreaterEqual(len(binop_count), 3)
@@ -505,7 +507,8 @@ def testfunc(loops):
         ex = get_first_executor(testfunc)
         self.assertIsNotNone(ex)
         self.assertEqual(res, (TIER2_THRESHOLD - 1) * 4)
-        binop_count = [opname for opname in iter_opnames(ex) if opname == "_BINARY_OP_ADD_INT"]
+        binop_count = [opname for opname in iter_opnames(ex)
+                       if opname in ("_BINARY_OP_ADD_INT", "_BINARY_OP_INPLACE_ADD_INT")]
         guard_tos_int_count = [opname for opname in iter_opnames(ex) if opname == "_GUARD_TOS_INT"]
         guard_nos_int_count = [opname for opname in iter_opnames(ex) if opname == "_GUARD_NOS_INT"]
         self.assertGreaterEqual(len(binop_count), 3)
@@ -525,7 +528,8 @@ def testfunc(loops):
 
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
         self.assertIsNotNone(ex)
-        binop_count = [opname for opname in iter_opnames(ex) if opname == "_BINARY_OP_ADD_INT"]
+        binop_count = [opname for opname in iter_opnames(ex)
+                       if opname in ("_BINARY_OP_ADD_INT", "_BINARY_OP_INPLACE_ADD_INT")]
         self.assertGreaterEqual(len(binop_count), 3)
 
     def test_call_py_exact_args(self):
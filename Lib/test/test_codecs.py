@@ -920,6 +920,25 @@ def test_incremental_errors(self):
                 dec = codecs.getincrementaldecoder(self.encoding)()
                 self.assertRaises(UnicodeDecodeError, dec.decode, data)
 
+    def test_ascii_runs(self):
+        # Runs of ASCII characters are checked and copied in blocks: test
+        # them at every offset and length around the block size, next to
+        # characters of each kind.
+        for char in '\xe9', '\u20ac', '\U0001f600', '\udc80':
+            errors = 'surrogatepass' if char == '\udc80' else 'strict'
+            encoded = char.encode(self.encoding, errors)[len(self.BOM):]
+            for before in range(20):
+                for after in range(0, 40, 3):
+                    s = 'a' * before + char + 'b' * after + char
+                    with self.subTest(char=char, before=before, after=after):
+                        data = s.encode(self.encoding, errors)
+                        self.assertEqual(data, self.BOM + b'a' * before + encoded
+                                               + b'b' * after + encoded)
+                        decoded = data.decode(self.encoding, errors)
+                        self.assertEqual(decoded, s)
+                        # The string is created with the smallest kind.
+                        self.assertEqual(sys.getsizeof(decoded), sys.getsizeof(s))
+
 
 class UTF7Test(ReadTest, unittest.TestCase):
     encoding = "utf-7"
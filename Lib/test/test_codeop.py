@@ -2,12 +2,15 @@
    Test cases for codeop.py
    Nick Mathewson
 """
+import ast
+import os
+import sys
 import unittest
 import warnings
-from test.support import warnings_helper
+from test.support import os_helper, script_helper, warnings_helper
 from textwrap import dedent
 
-from codeop import compile_command, PyCF_DONT_IMPLY_DEDENT
+from codeop import compile_command, CompileCache, PyCF_DONT_IMPLY_DEDENT
 
 class CodeopTests(unittest.TestCase):
 
@@ -325,6 +328,87 @@ def foo(x,x):
             """), "duplicate parameter 'x' in function definition")
 
 
+class CompileCacheTests(unittest.TestCase):
+
+    def test_cache(self):
+        cache = CompileCache()
+        code = cache("x = 1", "<cached>", "exec")
+        self.assertEqual(code, compile("x = 1", "<cached>", "exec"))
+        self.assertIs(cache("x = 1", "<cached>", "exec"), code)
+        self.assertIs(cache(b"x = 1", "<cached>", "exec"),
+                      cache(b"x = 1", "<cached>", "exec"))
+        for args in [("x = 2", "<cached>", "exec"),
+                     ("x = 1", "<other>", "exec"),
+                     ("x = 1", "<cached>", "single"),
+                     ("x = 1", "<cached>", "exec", PyCF_DONT_IMPLY_DEDENT),
+                     ("x = 1", "<cached>", "exec", 0, 2)]:
+            with self.subTest(args=args):
+                self.assertIsNot(cache(*args), code)
+        cache.clear()
+        self.assertIsNot(cache("x = 1", "<cached>", "exec"), code)
+
+    def test_maxsize(self):
+        cache = CompileCache(maxsize=2)
+        first = cache("1", "<cached>", "eval")
+        second = cache("2", "<cached>", "eval")
+        self.assertIs(cache("1", "<cached>", "eval"), first)
+        cache("3", "<cached>", "eval")
+        # The least recently used code object was dropped.
+        self.assertIs(cache("1", "<cached>", "eval"), first)
+        self.assertIsNot(cache("2", "<cached>", "eval"), second)
+
+        cache = CompileCache(maxsize=0)
+        self.assertIsNot(cache("1", "<cached>", "eval"),
+                         cache("1", "<cached>", "eval"))
+        self.assertRaises(ValueError, CompileCache, maxsize=-1)
+
+    def test_not_cached(self):
+        cache = CompileCache()
+        tree = cache("x = 1", "<cached>", "exec", ast.PyCF_ONLY_AST)
+        self.assertIsInstance(tree, ast.Module)
+        self.assertIsNot(cache(tree, "<cached>", "exec"),
+                         cache(tree, "<cached>", "exec"))
+        self.assertIsNot(cache(bytearray(b"x"), "<cached>", "eval"),
+                         cache(bytearray(b"x"), "<cached>", "eval"))
+
+    def test_directory(self):
+        with os_helper.temp_dir() as tmpdir:
+            directory = os.path.join(tmpdir, "cache")
+            code = CompileCache(directory=directory)("x = 1", "<cached>", "exec")
+            self.assertEqual(len(os.listdir(directory)), 1)
+            cache = CompileCache(directory=directory)
+            self.assertEqual(cache("x = 1", "<cached>", "exec"), code)
+            self.assertEqual(len(os.listdir(directory)), 1)
+            cache("x = 2", "<cached>", "exec")
+            self.assertEqual(len(os.listdir(directory)), 2)
+
+            # Invalid files are ignored.
+            for name in os.listdir(directory):
+                with open(os.path.join(directory, name), "wb") as f:
+                    f.write(b"invalid")
+            code = CompileCache(directory=directory)("x = 1", "<cached>", "exec")
+            self.assertEqual(code, compile("x = 1", "<cached>", "exec"))
+
+    def test_optimize(self):
+        cache = CompileCache()
+        code = cache("assert False", "<cached>", "exec")
+        self.assertIs(cache("assert False", "<cached>", "exec",
+                            optimize=sys.flags.optimize), code)
+
+    @unittest.skipIf(sys.flags.optimize, "needs assertions")
+    def test_directory_optimize(self):
+        # Code compiled under -O must not be used without it.
+        with os_helper.temp_dir() as directory:
+            script = ("import codeop, sys\n"
+                      "cache = codeop.CompileCache(directory=sys.argv[1])\n"
+                      "exec(cache('assert False', '<cached>', 'exec'))\n")
+            script_helper.assert_python_ok('-O', '-c', script, directory)
+            self.assertEqual(len(os.listdir(directory)), 1)
+            code = CompileCache(directory=directory)("assert False",
+                                                     "<cached>", "exec")
+            self.assertRaises(AssertionError, exec, code)
+            self.assertEqual(len(os.listdir(directory)), 2)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -2,6 +2,7 @@
 import asyncio
 import contextlib
 import io
+import operator
 import os
 import subprocess
 import sys
@@ -92,6 +93,11 @@ def get_current_interpid(*extra):
     return (interpid, *extra)
 
 
+def get_cached_callables():
+    from concurrent.futures import interpreter
+    return set(interpreter._callables)
+
+
 class InterpretersMixin(InterpreterPoolMixin):
 
     def pipe(self):
@@ -317,6 +323,20 @@ def test_submit_func_globals(self):
         self.assertEqual(name, __name__)
         self.assertNotEqual(name, '__main__')
 
+    def test_submit_func_by_reference(self):
+        executor = self.executor_type(1)
+        self.assertEqual(executor.submit(operator.mul, 6, 7).result(), 42)
+        self.assertEqual(executor.submit(operator.mul, 2, 3).result(), 6)
+        self.assertEqual(executor.submit(sorted, [2, 1], reverse=True).result(),
+                         [2, 1])
+        cached = executor.submit(get_cached_callables).result()
+        self.assertEqual(cached, {
+            ('_operator', 'mul'),
+            ('builtins', 'sorted'),
+            (__name__, 'get_cached_callables'),
+        })
+        executor.shutdown()
+
     @unittest.expectedFailure
     def test_submit_exception_in_script(self):
         # Scripts are not supported currently.
@@ -24,6 +24,38 @@ def record_finished(n):
         self.executor.shutdown(wait=True)
         self.assertCountEqual(finished, range(10))
 
+    def test_submit_many(self):
+        fs = self.executor.submit_many(pow, [(2, 3), (3, 2), (10, 0)])
+        self.assertEqual([f.result() for f in fs], [8, 9, 1])
+        self.assertEqual(self.executor.submit_many(pow, []), [])
+
+    def test_submit_many_exception(self):
+        fs = self.executor.submit_many(divmod, [(4, 2), (1, 0)])
+        self.assertEqual(fs[0].result(), (2, 0))
+        with self.assertRaises(ZeroDivisionError):
+            fs[1].result()
+
+    def test_submit_many_after_shutdown(self):
+        self.executor.shutdown()
+        with self.assertRaises(RuntimeError):
+            self.executor.submit_many(pow, [(2, 3)])
+
+    def test_map_chunksize(self):
+        for chunksize in (2, 3, 10, 100):
+            with self.subTest(chunksize=chunksize):
+                self.assertEqual(
+                    list(self.executor.map(pow, range(10), range(10),
+                                           chunksize=chunksize)),
+                    list(map(pow, range(10), range(10))))
+        with self.assertRaises(ValueError):
+            self.executor.map(pow, range(10), range(10), chunksize=0)
+
+    def test_map_chunksize_buffersize(self):
+        it = iter(range(20))
+        results = self.executor.map(str, it, chunksize=3, buffersize=2)
+        self.assertEqual(next(results), '0')
+        self.assertEqual(list(results), [str(i) for i in range(1, 20)])
+
     def test_default_workers(self):
         executor = self.executor_type()
         expected = min(32, (os.process_cpu_count() or 1) + 4)
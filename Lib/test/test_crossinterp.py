@@ -1296,8 +1296,23 @@ def test_strs(self):
             'hello world',
             '你好世界',
             '',
+            'a',
+            '\xe9',
+            '\U0001f600',
+            'caf\xe9' * 1000,
+            'spam\U0001f600' * 1000,
+            '\ud800\udc00',
         ])
 
+    def test_str_hash(self):
+        for obj in ['spam' * 100, 'caf\xe9' * 100, '你好世界' * 100]:
+            with self.subTest(obj[:8]):
+                expected = hash(obj)
+                got = self.get_roundtrip(obj)
+                self.assertIsNot(got, obj)
+                self.assertEqual(hash(got), expected)
+                self.assertEqual(got, obj)
+
     def test_int(self):
         bounds = [sys.maxsize, -sys.maxsize - 1]
         values = itertools.chain(range(-1, 258), bounds)
@@ -933,6 +933,70 @@ def __eq__(self, other):
         resizing = True
         d[9] = 6
 
+    def test_large_table_collisions(self):
+        # Tables with at least 2**16 slots keep some bits of the hash of
+        # each entry in the index; check keys whose hashes differ only in
+        # those bits, or only above them.
+        class H:
+            def __init__(self, h):
+                self.h = h
+            def __hash__(self):
+                return self.h
+            def __eq__(self, other):
+                return isinstance(other, H) and self.h == other.h
+        n = 50_000
+        d = {H(i << 17): i for i in range(n)}
+        d.update({H((i << 17) | (1 << 16)): -i for i in range(n)})
+        d.update({f"s{i}": i for i in range(n)})
+        self.assertEqual(len(d), 3 * n)
+        for i in range(0, n, 97):
+            self.assertEqual(d[H(i << 17)], i)
+            self.assertEqual(d[H((i << 17) | (1 << 16))], -i)
+            self.assertEqual(d[f"s{i}"], i)
+            self.assertNotIn(H((i << 17) | (1 << 18) | 1), d)
+            self.assertNotIn(f"t{i}", d)
+        for i in range(0, n, 2):
+            del d[H(i << 17)]
+        self.assertEqual(len(d), 3 * n - n // 2)
+        self.assertNotIn(H(0), d)
+        self.assertEqual(d[H(1 << 17)], 1)
+        self.assertEqual(d.popitem(), (f"s{n - 1}", n - 1))
+        self.assertEqual(d.copy(), d)
+
+    def test_bulk_construction(self):
+        pairs = [(k, str(k)) for k in range(1000)]
+        expected = {k: str(k) for k in range(1000)}
+        for source in (pairs * 3, tuple(pairs * 3), iter(pairs * 3)):
+            self.assertEqual(dict(source), expected)
+        self.assertEqual(dict.fromkeys([str(k) for k in range(1000)] * 3),
+                         dict.fromkeys(map(str, range(1000))))
+        self.assertEqual(dict.fromkeys(tuple(range(1000)) * 3),
+                         dict.fromkeys(range(1000)))
+        mapping = collections.UserDict(expected)
+        self.assertEqual(dict(mapping), expected)
+        # Growing the table ahead of time must not over-allocate a dict
+        # built from a source with many duplicates.
+        grown = {}
+        for k in range(1000):
+            grown[k] = None
+        dups = [k // 100 for k in range(100_000)]
+        self.assertEqual(sys.getsizeof(dict.fromkeys(dups)),
+                         sys.getsizeof(grown))
+        self.assertEqual(sys.getsizeof(dict(zip(dups, dups))),
+                         sys.getsizeof(grown))
+
+    def test_bulk_construction_mutating_source(self):
+        class Key:
+            def __hash__(self):
+                return 0
+            def __eq__(self, other):
+                source.clear()
+                return False
+        source = [(Key(), i) for i in range(100)]
+        self.assertEqual(len(dict(source)), 2)
+        source = [Key() for _ in range(100)]
+        self.assertEqual(len(dict.fromkeys(source)), 2)
+
     def test_empty_presized_dict_in_freelist(self):
         # Bug #3537: if an empty but presized dict with a size larger
         # than 7 was in the freelist, it triggered an assertion failure
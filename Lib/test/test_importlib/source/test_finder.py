@@ -8,8 +8,12 @@
 import stat
 import sys
 import tempfile
+from test.support import os_helper
 from test.support.import_helper import make_legacy_pyc
+from test.support.script_helper import assert_python_ok, assert_python_failure
 import unittest
+import unittest.mock
+from importlib._bootstrap_external import _DirectoryIndex
 
 
 class FinderTests(abc.FinderTests):
@@ -208,5 +212,135 @@ def _find(self, finder, name, loader_only=False):
  ) = util.test_both(FinderTestsPEP420, machinery=machinery)
 
 
+class DirectoryIndexTests(unittest.TestCase):
+
+    """Test the persistent directory index (PYTHONIMPORTDIRCACHE)."""
+
+    def setUp(self):
+        self.dir = self.enterContext(os_helper.temp_dir())
+        self.index = os.path.join(self.dir, 'index')
+        self.path = os.path.join(self.dir, 'path')
+        os.mkdir(self.path)
+
+    def add_module(self, name):
+        with open(os.path.join(self.path, name + '.py'), 'w',
+                  encoding='utf-8') as file:
+            file.write('x = 1\n')
+        # Listings of recently modified directories are not recorded.
+        self.set_mtime(os.stat(self.path).st_mtime_ns - 10**10)
+
+    def set_mtime(self, mtime_ns):
+        os.utime(self.path, ns=(mtime_ns, mtime_ns))
+
+    def run_import(self, name, *, ok=True, code=''):
+        assert_python = assert_python_ok if ok else assert_python_failure
+        return assert_python('-c', f'{code}import {name}',
+                             PYTHONIMPORTDIRCACHE=self.index,
+                             PYTHONPATH=self.path)
+
+    def test_index(self):
+        self.add_module('indexed_a')
+        self.run_import('indexed_a')
+        self.assertTrue(os.path.exists(self.index))
+        mtime = os.stat(self.path).st_mtime_ns
+
+        # The recorded listing is trusted while the mtime is unchanged.
+        self.add_module('indexed_b')
+        self.set_mtime(mtime)
+        self.run_import('indexed_b', ok=False)
+        self.run_import('indexed_b',
+                        code='import importlib; importlib.invalidate_caches(); ')
+
+        # A new mtime makes the directory be listed again.
+        self.set_mtime(mtime - 10**9)
+        self.run_import('indexed_b')
+
+    def test_forget(self):
+        self.add_module('indexed_a')
+        index = _DirectoryIndex(self.index)
+        index.listdir(self.path)
+        index.save()
+        index = _DirectoryIndex(self.index)
+        self.assertIn(self.path, index._entries)
+        # The dropped listing is also removed from the file.
+        index.forget(self.path)
+        index.save()
+        self.assertNotIn(self.path, _DirectoryIndex(self.index)._entries)
+
+    def test_save_once(self):
+        self.add_module('indexed_a')
+        other = os.path.join(self.dir, 'other')
+        os.mkdir(other)
+        mtime = os.stat(self.path).st_mtime_ns
+        os.utime(other, ns=(mtime, mtime))
+        index = _DirectoryIndex(self.index)
+        self.assertEqual(index.listdir(self.path), ['indexed_a.py'])
+        self.assertEqual(index.listdir(other, mtime), [])
+        # Nothing is written until save() is called.
+        self.assertFalse(os.path.exists(self.index))
+        index.save()
+        entries = _DirectoryIndex(self.index)._entries
+        self.assertEqual(entries[self.path], (mtime, ('indexed_a.py',)))
+        self.assertEqual(entries[other], (mtime, ()))
+        # An unchanged index is not written again.
+        os.unlink(self.index)
+        self.assertEqual(index.listdir(self.path), ('indexed_a.py',))
+        index.save()
+        self.assertFalse(os.path.exists(self.index))
+
+    def make_dirs(self, *names):
+        mtime = os.stat(self.path).st_mtime_ns - 10**10
+        paths = []
+        for name in names:
+            path = os.path.join(self.dir, name)
+            os.mkdir(path)
+            os.utime(path, ns=(mtime, mtime))
+            paths.append(path)
+        return paths
+
+    def test_merge(self):
+        # Concurrent processes do not drop the entries of each other.
+        a, b, c = self.make_dirs('a', 'b', 'c')
+        index = _DirectoryIndex(self.index)
+        index.listdir(a)
+        index.save()
+        first = _DirectoryIndex(self.index)
+        second = _DirectoryIndex(self.index)
+        first.listdir(b)
+        second.listdir(c)
+        second.forget(a)
+        first.save()
+        second.save()
+        self.assertEqual(list(_DirectoryIndex(self.index)._entries), [b, c])
+
+    def test_max_entries(self):
+        paths = self.make_dirs('a', 'b', 'c', 'd')
+        index = _DirectoryIndex(self.index)
+        for path in paths[:3]:
+            index.listdir(path)
+        index.save()
+        # The entries least recently used by a writing process are dropped.
+        index = _DirectoryIndex(self.index)
+        index.listdir(paths[0])
+        index.listdir(paths[3])
+        with unittest.mock.patch.object(_DirectoryIndex, '_MAX_ENTRIES', 3):
+            index.save()
+        self.assertEqual(list(_DirectoryIndex(self.index)._entries),
+                         [paths[2], paths[0], paths[3]])
+
+    def test_invalid_index(self):
+        with open(self.index, 'wb') as file:
+            file.write(b'garbage')
+        self.add_module('indexed_a')
+        self.run_import('indexed_a')
+
+    def test_disabled(self):
+        self.add_module('indexed_a')
+        assert_python_ok('-E', '-c', 'import sys; sys.path.append(sys.argv[1]); '
+                         'import indexed_a', self.path,
+                         PYTHONIMPORTDIRCACHE=self.index)
+        self.assertFalse(os.path.exists(self.index))
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -9,10 +9,11 @@
 from importlib import _bootstrap_external
 import os
 import pathlib
+import py_compile
 import string
 import sys
 from test import support
-from test.support import os_helper
+from test.support import import_helper, os_helper
 import textwrap
 import types
 import unittest
@@ -857,5 +858,62 @@ def test_atomic_write_errors_if_unable_to_complete(self):
             os.stat(support.os_helper.TESTFN) # Check that the file did not get written.
 
 
+class PrefetchTests(unittest.TestCase):
+
+    def setUp(self):
+        self.dir = self.enterContext(os_helper.temp_dir())
+        self.enterContext(import_helper.DirsOnSysPath(self.dir))
+        self.addCleanup(_bootstrap_external._prefetched_code.clear)
+
+    def make_module(self, name, value):
+        path = os.path.join(self.dir, name + '.py')
+        with open(path, 'w', encoding='utf-8') as file:
+            file.write(f'def f():\n    return {value!r}\n')
+        py_compile.compile(path, doraise=True)
+        importlib.invalidate_caches()
+        return path
+
+    def prefetch(self, *paths, **kwargs):
+        for thread in importlib.util.prefetch(paths, **kwargs):
+            thread.join()
+
+    def test_prefetch(self):
+        paths = [self.make_module(f'prefetched_{i}', i) for i in range(3)]
+        self.prefetch(*paths, max_workers=2)
+        cached = [importlib.util.cache_from_source(path) for path in paths]
+        self.assertCountEqual(_bootstrap_external._prefetched_code, cached)
+        code = _bootstrap_external._prefetched_code[cached[0]][1]
+
+        with import_helper.CleanImport('prefetched_0'):
+            import prefetched_0
+            nested = [c for c in code.co_consts if isinstance(c, types.CodeType)]
+            self.assertIs(prefetched_0.f.__code__, nested[0])
+            self.assertEqual(prefetched_0.f(), 0)
+        self.assertNotIn(cached[0], _bootstrap_external._prefetched_code)
+
+    def test_limit(self):
+        paths = [self.make_module(f'prefetched_limit_{i}', i) for i in range(3)]
+        with unittest.mock.patch.object(_bootstrap_external,
+                                        '_PREFETCH_LIMIT', 2):
+            self.prefetch(*paths)
+        cached = [importlib.util.cache_from_source(path) for path in paths]
+        self.assertCountEqual(_bootstrap_external._prefetched_code, cached[:2])
+
+    def test_stale_bytecode(self):
+        path = self.make_module('prefetched_stale', 'old')
+        self.prefetch(path)
+        self.make_module('prefetched_stale', 'new value')
+        with import_helper.CleanImport('prefetched_stale'):
+            import prefetched_stale
+            self.assertEqual(prefetched_stale.f(), 'new value')
+
+    def test_invalid_paths(self):
+        path = os.path.join(self.dir, 'missing.py')
+        self.prefetch(path, os.path.join(self.dir, 'not_a_source'))
+        self.assertEqual(_bootstrap_external._prefetched_code, {})
+        with self.assertRaises(ValueError):
+            importlib.util.prefetch([path], max_workers=0)
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -1,7 +1,6 @@
 import sys
 
 import unittest
-from unittest import mock
 from test import support
 from test.support.numbers import (
     VALID_UNDERSCORE_LITERALS,
@@ -738,8 +737,9 @@ class IntSubclassStrDigitLimitsTests(IntStrDigitLimitsTests):
 
 
 class PyLongModuleTests(unittest.TestCase):
-    # Tests of the functions in _pylong.py.  Those get used when the
-    # number of digits in the input values are large enough.
+    # Tests of the conversions of integers with many digits, which use
+    # divide-and-conquer algorithms, and of the functions in _pylong.py,
+    # which implement the same algorithms in Python.
 
     def setUp(self):
         super().setUp()
@@ -794,38 +794,23 @@ def test_pylong_str_to_int(self):
         with self.assertRaises(ValueError) as err:
             int('_' + s)
 
-    @support.cpython_only  # tests implementation details of CPython.
-    @unittest.skipUnless(_pylong, "_pylong module required")
-    @mock.patch.object(_pylong, "int_to_decimal_string")
-    def test_pylong_misbehavior_error_path_to_str(
-            self, mock_int_to_str):
-        with support.adjust_int_max_str_digits(20_000):
-            big_value = int('7'*19_999)
-            mock_int_to_str.return_value = None  # not a str
-            with self.assertRaises(TypeError) as ctx:
-                str(big_value)
-            self.assertIn('_pylong.int_to_decimal_string did not',
-                          str(ctx.exception))
-            mock_int_to_str.side_effect = RuntimeError("testABC")
-            with self.assertRaises(RuntimeError):
-                str(big_value)
-
-    @support.cpython_only  # tests implementation details of CPython.
-    @unittest.skipUnless(_pylong, "_pylong module required")
-    @mock.patch.object(_pylong, "int_from_string")
-    def test_pylong_misbehavior_error_path_from_str(
-            self, mock_int_from_str):
-        big_value = '7'*19_999
-        with support.adjust_int_max_str_digits(20_000):
-            mock_int_from_str.return_value = b'not an int'
-            with self.assertRaises(TypeError) as ctx:
-                int(big_value)
-            self.assertIn('_pylong.int_from_string did not',
-                          str(ctx.exception))
-
-            mock_int_from_str.side_effect = RuntimeError("test123")
-            with self.assertRaises(RuntimeError):
-                int(big_value)
+    def test_str_to_int_divide_and_conquer(self):
+        # Compare with converting chunks short enough for the quadratic
+        # algorithm to be used.
+        from random import choice
+        for base in 3, 7, 10, 36:
+            for length in 2001, 4096, 30_001:
+                with self.subTest(base=base, length=length):
+                    digits = '0123456789abcdefghijklmnopqrstuvwxyz'[:base]
+                    s = ''.join(choice(digits) for _ in range(length))
+                    expected = 0
+                    for i in range(0, length, 1000):
+                        chunk = s[i:i+1000]
+                        expected = (expected * base**len(chunk) +
+                                    int(chunk, base))
+                    self.assertEqual(int(s, base), expected)
+                    s2 = '_'.join(s[i:i+7] for i in range(0, length, 7))
+                    self.assertEqual(int(s2, base), expected)
 
     def test_pylong_roundtrip(self):
         from random import randrange, getrandbits
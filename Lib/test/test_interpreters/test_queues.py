@@ -1,6 +1,7 @@
 import importlib
 import pickle
 import threading
+import time
 from textwrap import dedent
 import unittest
 
@@ -19,6 +20,16 @@ def get_num_queues():
     return len(_queues.list_all())
 
 
+def _fail_unpickling():
+    raise ValueError('spam')
+
+
+class Unpicklable:
+    # Pickled fine, but fails to be unpickled.
+    def __reduce__(self):
+        return (_fail_unpickling, ())
+
+
 class TestBase(_TestBase):
     def tearDown(self):
         for qid, _, _ in _queues.list_all():
@@ -638,6 +649,121 @@ def test_put_cleared_with_subinterpreter_multiple(self):
         self.assertIs(obj10, queues.UNBOUND)
         self.assertEqual(queue.qsize(), 0)
 
+    def test_put_many_get_many(self):
+        queue = queues.create()
+        queue.put_many(range(5))
+        queue.put_many(iter([5, 'spam']))
+        queue.put_many([])
+        self.assertEqual(queue.qsize(), 7)
+        self.assertEqual(queue.get_many(3), [0, 1, 2])
+        self.assertEqual(queue.get_many(10), [3, 4, 5, 'spam'])
+        self.assertTrue(queue.empty())
+        with self.assertRaises(queues.QueueEmpty):
+            queue.get_many(1, timeout=0.1)
+        with self.assertRaises(queues.QueueEmpty):
+            queue.get_many(1, False)
+        with self.assertRaises(ValueError):
+            queue.get_many(0)
+
+    def test_get_many_unpickling_error(self):
+        queue = queues.create(4)
+        queue.put_many([0, 1, Unpicklable(), 3])
+        # The objects before the bad one are returned.
+        self.assertEqual(queue.get_many(10), [0, 1])
+        # The bad one and the ones after it are put back in the queue.
+        self.assertEqual(queue.qsize(), 2)
+        queue.put_many([4, 5])
+        self.assertTrue(queue.full())
+        # The next get reports the error and drops the bad one.
+        with self.assertRaises(interpreters.NotShareableError):
+            queue.get_many(10)
+        self.assertEqual(queue.get_many(10), [3, 4, 5])
+
+    def test_put_many_full(self):
+        queue = queues.create(3)
+        with self.assertRaises(queues.QueueFull):
+            queue.put_many(range(5), timeout=0.1)
+        # The objects that fit stay in the queue.
+        self.assertEqual(queue.get_many(5), [0, 1, 2])
+        with self.assertRaises(queues.QueueFull):
+            queue.put_many(range(5), False)
+        self.assertEqual(queue.qsize(), 3)
+
+    def test_put_many_blocking(self):
+        queue = queues.create(2)
+        received = []
+        def f():
+            while len(received) < 10:
+                received.extend(queue.get_many(10))
+        t = threading.Thread(target=f)
+        t.start()
+        queue.put_many(range(10))
+        t.join()
+        self.assertEqual(received, list(range(10)))
+
+    def test_get_blocks_until_put(self):
+        queue = queues.create()
+        started = threading.Event()
+        result = []
+        def f():
+            started.set()
+            result.append(queue.get(timeout=HUGE_TIMEOUT))
+        t = threading.Thread(target=f)
+        t.start()
+        started.wait()
+        queue.put('spam')
+        t.join()
+        self.assertEqual(result, ['spam'])
+
+    def test_put_blocks_until_get(self):
+        queue = queues.create(1)
+        queue.put(1)
+        started = threading.Event()
+        def f():
+            started.set()
+            queue.put(2, timeout=HUGE_TIMEOUT)
+        t = threading.Thread(target=f)
+        t.start()
+        started.wait()
+        self.assertEqual(queue.get(), 1)
+        t.join()
+        self.assertEqual(queue.get_nowait(), 2)
+
+    def test_get_blocks_across_interpreters(self):
+        interp = interpreters.create()
+        queue1 = queues.create()
+        queue2 = queues.create()
+        def f():
+            interp.exec(dedent(f"""
+                from concurrent.interpreters import _queues as queues
+                queue1 = queues.Queue({queue1.id})
+                queue2 = queues.Queue({queue2.id})
+                queue2.put(queue1.get())
+                """))
+        t = threading.Thread(target=f)
+        t.start()
+        queue1.put(b'spam')
+        obj = queue2.get(timeout=HUGE_TIMEOUT)
+        t.join()
+        self.assertEqual(obj, b'spam')
+
+    def test_get_blocked_when_destroyed(self):
+        queue = queues.create()
+        qid = queue.id
+        errors = []
+        def f():
+            try:
+                _queues.get(qid, blocking=True)
+            except Exception as exc:
+                errors.append(exc)
+        t = threading.Thread(target=f)
+        t.start()
+        time.sleep(0.1)
+        _queues.destroy(qid)
+        t.join()
+        self.assertEqual(len(errors), 1)
+        self.assertIsInstance(errors[0], queues.QueueNotFoundError)
+
     def test_put_get_different_threads(self):
         queue1 = queues.create()
         queue2 = queues.create()
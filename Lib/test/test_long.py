@@ -12,6 +12,9 @@
 BASE = 2 ** SHIFT
 MASK = BASE - 1
 KARATSUBA_CUTOFF = 70   # from longobject.c
+TOOM3_CUTOFF = 300      # from longobject.c
+NTT_CUTOFF = 12000      # from longobject.c
+BZ_CUTOFF = 100         # from longobject.c
 
 # Max number of base BASE digits to use in test cases.  Doubling
 # this will more than double the runtime.
@@ -229,6 +232,71 @@ def test_karatsuba(self):
                          1)
                     self.assertEqual(x, y)
 
+    def mul_in_slices(self, a, b, cutoff):
+        # Multiply by slices of a small enough that only the algorithms
+        # used below cutoff digits get used.
+        width = (cutoff // 2) * SHIFT
+        mask = (1 << width) - 1
+        sign = -1 if (a < 0) != (b < 0) else 1
+        a, b = abs(a), abs(b)
+        result = 0
+        shift = 0
+        while a:
+            result += ((a & mask) * b) << shift
+            a >>= width
+            shift += width
+        return sign * result
+
+    def check_multiplication(self, digits, cutoff):
+        def getran(ndigits):
+            x = random.getrandbits(ndigits * SHIFT) | (1 << (ndigits * SHIFT - 1))
+            return random.choice((x, -x))
+
+        for adigits in digits:
+            a = getran(adigits)
+            for bdigits in digits:
+                if not adigits <= bdigits < 2 * adigits:
+                    continue
+                with self.subTest(adigits=adigits, bdigits=bdigits):
+                    b = getran(bdigits)
+                    expected = self.mul_in_slices(a, b, cutoff)
+                    self.assertEqual(a * b, expected)
+                    self.assertEqual(b * a, expected)
+            with self.subTest(adigits=adigits):
+                self.assertEqual(a * a, self.mul_in_slices(a, a, cutoff))
+                # All coefficients at their maximal values.
+                x = (1 << (adigits * SHIFT)) - 1
+                self.assertEqual(x * x, self.mul_in_slices(x, x, cutoff))
+                self.assertEqual(x * (x + 1), x << (adigits * SHIFT))
+
+    def test_toom_cook(self):
+        self.check_multiplication([TOOM3_CUTOFF + 1, TOOM3_CUTOFF * 2 + 1,
+                                   TOOM3_CUTOFF * 7], TOOM3_CUTOFF)
+
+    def test_ntt(self):
+        self.check_multiplication([NTT_CUTOFF + 1, NTT_CUTOFF * 3 // 2],
+                                  NTT_CUTOFF)
+
+    def test_burnikel_ziegler_division(self):
+        digits = [BZ_CUTOFF + 1, BZ_CUTOFF * 2 + 3, BZ_CUTOFF * 5 + 1,
+                  BZ_CUTOFF * 20]
+        for ydigits in digits:
+            for qdigits in digits:
+                with self.subTest(ydigits=ydigits, qdigits=qdigits):
+                    y = self.getran(ydigits)
+                    x = self.getran(ydigits + qdigits)
+                    self.check_division(x, y)
+                    # Divisors with all-ones top digits, whose quotient
+                    # digit estimates overflow.
+                    y = (1 << (ydigits * SHIFT)) - 1 - self.getran(2)
+                    x = (1 << ((ydigits + qdigits) * SHIFT)) - 1
+                    self.check_division(x, y)
+                    self.check_division(x, y - (1 << ((ydigits // 2) * SHIFT)))
+                    # Exact division.
+                    q = self.getran(qdigits)
+                    self.assertEqual((q * y) // y, q)
+                    self.assertEqual((q * y) % y, 0)
+
     def check_bitop_identities_1(self, x):
         eq = self.assertEqual
         with self.subTest(x=x):
@@ -1640,8 +1640,8 @@ def func():
             ('branch', 'func', 4, 4),
             ('line', 'func', 5),
             ('line', 'meth', 1),
-            ('jump', 'func', 5, '[offset=120]'),
-            ('branch', 'func', '[offset=124]', '[offset=130]'),
+            ('jump', 'func', 5, '[offset=112]'),
+            ('branch', 'func', '[offset=116]', '[offset=122]'),
             ('line', 'get_events', 11)])
 
         self.check_events(func, recorders = FLOW_AND_LINE_RECORDERS, expected = [
@@ -1655,8 +1655,8 @@ def func():
             ('line', 'func', 5),
             ('line', 'meth', 1),
             ('return', 'meth', None),
-            ('jump', 'func', 5, '[offset=120]'),
-            ('branch', 'func', '[offset=124]', '[offset=130]'),
+            ('jump', 'func', 5, '[offset=112]'),
+            ('branch', 'func', '[offset=116]', '[offset=122]'),
             ('return', 'func', None),
             ('line', 'get_events', 11)])
 
@@ -1750,6 +1750,23 @@ def callback(code, from_, to):
 
         self.assertEqual(func("true"), 1)
 
+    def test_if_all(self):
+
+        def func(xs):
+            if all(x for x in xs):
+                return 1
+            return 2
+
+        def run():
+            func([1])
+            func([0])
+
+        # Both arcs of the "if" test are taken with the inlined all().
+        events = self.get_events(run, TEST_TOOL, BRANCH_OFFSET_RECORDERS)
+        src, left, right = list(func.__code__.co_branches())[-1]
+        self.assertIn(('branch left', 'func', src, left), events)
+        self.assertIn(('branch right', 'func', src, right), events)
+
 
 class TestBranchConsistency(MonitoringTestBase, unittest.TestCase):
 
@@ -1351,6 +1351,34 @@ def binary_op_int_non_compact():
                 c = a * b
                 self.assertEqual(c, 10000000000)
 
+        def binary_op_inplace_int():
+            for _ in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+                a, b = 1000, 1
+                c = a
+                a += b
+                self.assertEqual(a, 1001)
+                self.assertEqual(c, 1000)
+                a = a - b
+                self.assertEqual(a, 1000)
+                a -= 2000
+                self.assertEqual(a, -1000)
+                a += 1000
+                self.assertEqual(a, 0)
+                self.assertIs(a, 0)
+
+        binary_op_inplace_int()
+        self.assert_specialized(binary_op_inplace_int, "BINARY_OP_INPLACE_ADD_INT")
+        self.assert_specialized(binary_op_inplace_int, "BINARY_OP_INPLACE_SUBTRACT_INT")
+        self.assert_no_opcode(binary_op_inplace_int, "BINARY_OP")
+
+        def binary_op_inplace_int_overflow():
+            for i in range(_testinternalcapi.SPECIALIZATION_THRESHOLD * 2):
+                a = 2**30 - _testinternalcapi.SPECIALIZATION_THRESHOLD
+                a += i
+                self.assertEqual(a, 2**30 - _testinternalcapi.SPECIALIZATION_THRESHOLD + i)
+
+        binary_op_inplace_int_overflow()
+
         binary_op_int_non_compact()
         self.assert_no_opcode(binary_op_int_non_compact, "BINARY_OP_ADD_INT")
         self.assert_no_opcode(binary_op_int_non_compact, "BINARY_OP_SUBTRACT_INT")
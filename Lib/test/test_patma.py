@@ -7,6 +7,7 @@
 import sys
 import unittest
 from test import support
+from test.support import script_helper
 
 
 @dataclasses.dataclass
@@ -2889,6 +2890,229 @@ class B(A): ...
                 self.assertEqual(h, 1)
 
 
+class TestDispatch(unittest.TestCase):
+    # Runs of many cases matching literals are compiled to a table lookup.
+
+    @staticmethod
+    def dispatch(x):
+        match x:
+            case 0:
+                return "zero"
+            case 1 | 2:
+                return "small"
+            case 3:
+                return 3
+            case "a":
+                return "A"
+            case 4.5:
+                return 4.5
+            case 5j:
+                return 5j
+            case -6:
+                return -6
+            case 7 | "b":
+                return 7
+            case 8:
+                return 8
+            case 9:
+                return 9
+            case 10:
+                return 10
+            case 11:
+                return 11
+            case 1:
+                return "unreachable"
+            case [y]:
+                return ("list", y)
+            case _:
+                return "default"
+
+    def assertUsesTable(self, func, count=1):
+        instructions = dis.get_instructions(func)
+        argreprs = [i.argrepr for i in instructions]
+        self.assertEqual(argreprs.count("INTRINSIC_MATCH_VALUE_DISPATCH"), count)
+
+    def test_uses_table(self):
+        self.assertUsesTable(self.dispatch)
+
+    def test_line_events(self):
+        # Only the match, the first case and the matching case are traced,
+        # not each case tested before it.
+        def f(x):
+            match x:
+                case 0: return 0
+                case 1: return 1
+                case 2: return 2
+                case 3: return 3
+                case 4: return 4
+                case 5: return 5
+                case 6: return 6
+                case 7: return 7
+                case 8: return 8
+                case 9: return 9
+                case 10: return 10
+                case 11: return 11
+                case 12: return 12
+                case 13: return 13
+            return -1
+
+        def trace(x):
+            lines = []
+            def tracer(frame, event, arg):
+                if frame.f_code is f.__code__ and event == 'line':
+                    lines.append(frame.f_lineno - f.__code__.co_firstlineno)
+                return tracer
+            old_trace = sys.gettrace()
+            sys.settrace(tracer)
+            try:
+                f(x)
+            finally:
+                sys.settrace(old_trace)
+            return lines
+
+        self.assertUsesTable(f)
+        self.assertEqual(trace(5), [1, 2, 7])
+        self.assertEqual(trace(99), [1, 2, 16])
+
+    def test_exact_types(self):
+        cases = [
+            (0, "zero"), (1, "small"), (2, "small"), (3, 3), ("a", "A"),
+            (4.5, 4.5), (5j, 5j), (-6, -6), (7, 7), ("b", 7),
+            (0.0, "zero"), (-0.0, "zero"), (3 + 0j, 3), (True, "small"),
+            (False, "zero"), (11, 11), (12, "default"), ("c", "default"),
+            ([9], ("list", 9)), ([], "default"),
+            ({}, "default"), (None, "default"),
+        ]
+        for subject, expected in cases:
+            with self.subTest(subject=subject):
+                self.assertEqual(self.dispatch(subject), expected)
+
+    def test_custom_eq(self):
+        compared = []
+        class C:
+            def __init__(self, value):
+                self.value = value
+            def __eq__(self, other):
+                compared.append(other)
+                return self.value == other
+            __hash__ = None
+        self.assertEqual(self.dispatch(C("b")), 7)
+        self.assertEqual(compared, [0, 1, 2, 3, "a", 4.5, 5j, -6, 7, "b"])
+
+        class MyInt(int):
+            def __eq__(self, other):
+                return other == 3
+            __hash__ = int.__hash__
+        self.assertEqual(self.dispatch(MyInt(0)), 3)
+
+        class MyStr(str):
+            def __eq__(self, other):
+                return other == "a"
+            __hash__ = str.__hash__
+        self.assertEqual(self.dispatch(MyStr("b")), "A")
+
+    def test_eq_error(self):
+        class C:
+            def __eq__(self, other):
+                if other == 3:
+                    raise ZeroDivisionError
+                return False
+        with self.assertRaises(ZeroDivisionError):
+            self.dispatch(C())
+
+    def test_guard_and_capture(self):
+        def f(x, flag):
+            match x:
+                case 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9:
+                    return "digit"
+                case 10 if flag:
+                    return "guarded"
+                case 10 | 11 | 12 | 13 | 14 | 15 | 16 | 17 | 18 | 19:
+                    return "teen"
+                case 20 | 21 | 22 | 23 | 24 | 25 | 26 | 27:
+                    return "twenties"
+                case 30: return 30
+                case 31: return 31
+                case 32: return 32
+                case 33: return 33
+                case 34: return 34
+                case 35: return 35
+                case 36: return 36
+                case 37: return 37
+                case 38: return 38
+                case 39: return 39
+                case y:
+                    return y
+        self.assertUsesTable(f)
+        self.assertEqual(f(5, True), "digit")
+        self.assertEqual(f(10, True), "guarded")
+        self.assertEqual(f(10, False), "teen")
+        self.assertEqual(f(27, False), "twenties")
+        self.assertEqual(f(39, False), 39)
+        self.assertEqual(f(40, False), 40)
+        self.assertEqual(f("x", False), "x")
+
+    def test_no_default(self):
+        def f(x):
+            y = None
+            match x:
+                case 0: y = 0
+                case 1: y = 1
+                case 2: y = 2
+                case 3: y = 3
+                case 4: y = 4
+                case 5: y = 5
+                case 6: y = 6
+                case 7: y = 7
+                case 8: y = 8
+                case 9: y = 9
+                case 10: y = 10
+                case 11: y = 11
+            return y
+        self.assertUsesTable(f)
+        self.assertEqual([f(i) for i in range(-1, 13)],
+                         [None, *range(12), None])
+        self.assertIsNone(f([0]))
+
+    @unittest.skipIf(sys.flags.bytes_warning, "compares str and bytes")
+    def test_bytes(self):
+        def f(x):
+            match x:
+                case b"a": return 1
+                case b"b": return 2
+                case b"c": return 3
+                case b"d": return 4
+                case b"e": return 5
+                case b"f": return 6
+                case b"g": return 7
+                case b"h": return 8
+                case b"i": return 9
+                case b"j": return 10
+                case b"k": return 11
+                case b"l": return 12
+                case "a": return "str"
+            return None
+        self.assertUsesTable(f)
+        self.assertEqual(f(b"c"), 3)
+        self.assertEqual(f("a"), "str")
+        self.assertIsNone(f("b"))
+        self.assertEqual(f(bytearray(b"a")), 1)
+
+    def test_bytes_warning(self):
+        # Under -bb, comparing bytes with int or str raises, so the table
+        # must not skip the comparisons.
+        cases = "".join(f"        case {bytes([i])!r}: return {i}\n"
+                        for i in range(97, 109))
+        code = (f"def f(x):\n    match x:\n{cases}    return None\n"
+                "for x in (1, 'a'):\n"
+                "    try:\n"
+                "        f(x)\n"
+                "    except BytesWarning:\n"
+                "        print('BytesWarning')\n")
+        rc, out, err = script_helper.assert_python_ok('-bb', '-c', code)
+        self.assertEqual(out.splitlines(), [b'BytesWarning'] * 2)
+
+
 class TestSyntaxErrors(unittest.TestCase):
 
     def assert_syntax_error(self, code: str):
@@ -655,6 +655,36 @@ def f(x):
         self.assertTrue(f(True))
         self.check_lnotab(f)
 
+    def test_if_with_inlined_all(self):
+        def f(x):
+            if all(x):
+                return 1
+            return 0
+        self.assertEqual(f([]), 1)
+        self.assertEqual(f([1, 0]), 0)
+        self.check_lnotab(f)
+
+    def test_except_as_cleanup(self):
+        # The "e = None" before "del e" is not needed when e is known
+        # to be bound.
+        def f():
+            try:
+                raise ValueError
+            except ValueError as e:
+                pass
+        def g():
+            try:
+                raise ValueError
+            except ValueError as e:
+                del e
+            return 1
+        stores = [instr for instr in dis.get_instructions(f)
+                  if instr.opname == 'STORE_FAST']
+        self.assertEqual(len(stores), 1)
+        self.assertIsNone(f())
+        self.assertEqual(g(), 1)
+        self.check_lnotab(f)
+
     def test_trailing_nops(self):
         # Check the lnotab of a function that even after trivial
         # optimization has trailing nops, which the lnotab adjustment has to
@@ -2297,6 +2327,60 @@ def test_no_dead_store_elimination_in_different_lineno(self):
         ]
         self.cfg_optimization_test(insts, expected_insts, consts=list(range(3)), nlocals=1)
 
+    def test_dead_store_before_delete_elimination(self):
+        # "x = None; del x" as emitted for "except E as x"
+        insts = [
+            ('LOAD_CONST', 1, 1),
+            ('STORE_FAST', 0, 1),
+            ('LOAD_CONST', 0, 2),
+            ('STORE_FAST', 0, 2),
+            ('DELETE_FAST', 0, 2),
+            ('LOAD_CONST', 0, 3),
+            ('RETURN_VALUE', None, 3)
+        ]
+        expected_insts = [
+            ('LOAD_SMALL_INT', 1, 1),
+            ('STORE_FAST', 0, 1),
+            ('DELETE_FAST', 0, 2),
+            ('LOAD_CONST', 0, 3),
+            ('RETURN_VALUE', None, 3)
+        ]
+        self.cfg_optimization_test(insts, expected_insts,
+                                   consts=[None, 1], expected_consts=[None],
+                                   nlocals=1)
+
+    def test_no_dead_store_before_delete_elimination(self):
+        # The store cannot be removed if the local may be unbound
+        # before it, since DELETE_FAST would then raise.
+        insts = [
+            ('LOAD_CONST', 0, 2),
+            ('STORE_FAST', 0, 2),
+            ('DELETE_FAST', 0, 2),
+            ('LOAD_CONST', 0, 3),
+            ('RETURN_VALUE', None, 3)
+        ]
+        self.cfg_optimization_test(insts, insts, consts=[None], nlocals=1)
+
+    def test_self_assignment_elimination(self):
+        insts = [
+            ('LOAD_CONST', 1, 1),
+            ('STORE_FAST', 0, 1),
+            ('LOAD_FAST', 0, 2),
+            ('STORE_FAST', 0, 2),
+            ('LOAD_FAST', 0, 3),
+            ('RETURN_VALUE', None, 3)
+        ]
+        expected_insts = [
+            ('LOAD_SMALL_INT', 1, 1),
+            ('STORE_FAST', 0, 1),
+            ('NOP', None, 2),
+            ('LOAD_FAST_BORROW', 0, 3),
+            ('RETURN_VALUE', None, 3)
+        ]
+        self.cfg_optimization_test(insts, expected_insts,
+                                   consts=[None, 1], expected_consts=[None],
+                                   nlocals=1)
+
     def test_unconditional_jump_threading(self):
 
         def get_insts(lno1, lno2, op1, op2):
@@ -5,6 +5,7 @@
 import operator
 import pickle
 import re
+import sys
 import unittest
 import warnings
 import weakref
@@ -341,6 +342,32 @@ def test_do_not_rehash_dict_keys(self):
         self.assertEqual(sum(elem.hash_count for elem in d), n)
         self.assertEqual(d3, dict.fromkeys(d, 123))
 
+    def test_bulk_construction(self):
+        keys = list(range(1000))
+        expected = self.thetype(k for k in keys)
+        for source in (keys * 3, tuple(keys * 3), iter(keys * 3)):
+            self.assertEqual(self.thetype(source), expected)
+        strs = [str(k) for k in keys]
+        self.assertEqual(self.thetype(strs * 3),
+                         self.thetype(s for s in strs))
+        # Growing the table ahead of time must not over-allocate a set
+        # built from a source with many duplicates.
+        grown = self.thetype(k for k in keys)
+        dups = [k // 100 for k in range(100_000)]
+        self.assertEqual(sys.getsizeof(self.thetype(dups)),
+                         sys.getsizeof(grown))
+
+    def test_bulk_construction_mutating_source(self):
+        class Key:
+            def __hash__(self):
+                return 0
+            def __eq__(self, other):
+                source.clear()
+                return False
+        source = [Key() for _ in range(100)]
+        self.assertEqual(len(self.thetype(source)), 2)
+        self.assertEqual(source, [])
+
     def test_container_iterator(self):
         # Bug #3680: tp_traverse was not implemented for set iterator object
         class C(object):
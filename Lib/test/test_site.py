@@ -210,6 +210,69 @@ def test_addsitedir_dotfile(self):
         finally:
             pth_file.cleanup()
 
+    @support.requires_subprocess()
+    def test_addsitedir_dir_index(self):
+        # With PYTHONIMPORTDIRCACHE, the listing of the site directory and
+        # the contents of its .pth files are kept between runs.
+        from importlib._bootstrap_external import _DirectoryIndex
+        base_dir = self.enterContext(os_helper.temp_dir())
+        index_path = os.path.join(base_dir, 'index')
+        site_dir = os.path.join(base_dir, 'site')
+        pth_path = os.path.join(site_dir, 'test.pth')
+        os.mkdir(site_dir)
+        for name in ('first', 'second'):
+            os.mkdir(os.path.join(site_dir, name))
+        code = ('import site, sys; site.addsitedir(sys.argv[1]); '
+                'print(*[os.path.basename(p) for p in sys.path '
+                '        if p.startswith(sys.argv[1] + os.sep)])')
+        mtime = os.stat(site_dir).st_mtime_ns - 10**10
+        for name in ('first', 'first', 'second'):
+            with open(pth_path, 'w', encoding='utf-8') as f:
+                f.write(f'{name}\n')
+            mtime += 10**9
+            os.utime(pth_path, ns=(mtime, mtime))
+            os.utime(site_dir, ns=(mtime, mtime))
+            rc, out, err = assert_python_ok(
+                '-c', f'import os; {code}', site_dir,
+                PYTHONIMPORTDIRCACHE=index_path)
+            self.assertEqual(out.decode().strip(), name)
+            entries = _DirectoryIndex(index_path)._entries
+            self.assertEqual(entries[pth_path], (mtime, f'{name}\n'.encode()))
+            self.assertIn('test.pth', entries[site_dir][1])
+
+    @os_helper.skip_unless_symlink
+    @support.requires_subprocess()
+    def test_addsitedir_dir_index_symlink(self):
+        # A symlinked .pth file is validated against its target.
+        base_dir = self.enterContext(os_helper.temp_dir())
+        index_path = os.path.join(base_dir, 'index')
+        site_dir = os.path.join(base_dir, 'site')
+        target_path = os.path.join(base_dir, 'target.pth')
+        os.mkdir(site_dir)
+        for name in ('first', 'second'):
+            os.mkdir(os.path.join(site_dir, name))
+        pth_path = os.path.join(site_dir, 'test.pth')
+        os.symlink(target_path, pth_path)
+        code = ('import site, sys; site.addsitedir(sys.argv[1]); '
+                'print(*[os.path.basename(p) for p in sys.path '
+                '        if p.startswith(sys.argv[1] + os.sep)])')
+        mtime = os.stat(site_dir).st_mtime_ns - 10**10
+        if os.utime in os.supports_follow_symlinks:
+            os.utime(pth_path, ns=(mtime, mtime), follow_symlinks=False)
+        os.utime(site_dir, ns=(mtime, mtime))
+        for name in ('first', 'second'):
+            # Give the file the size of the symlink, padded with a comment.
+            content = f'{name}\n#'.encode()
+            content += b'#' * (len(os.fsencode(target_path)) - len(content))
+            with open(target_path, 'wb') as f:
+                f.write(content)
+            mtime += 10**9
+            os.utime(target_path, ns=(mtime, mtime))
+            rc, out, err = assert_python_ok(
+                '-c', f'import os; {code}', site_dir,
+                PYTHONIMPORTDIRCACHE=index_path)
+            self.assertEqual(out.decode().strip(), name)
+
     @unittest.skipUnless(hasattr(os, 'chflags'), 'test needs os.chflags()')
     def test_addsitedir_hidden_flags(self):
         pth_file = PthFile()
@@ -1169,6 +1169,31 @@ def test_is_gil_enabled(self):
         else:
             self.assertTrue(sys._is_gil_enabled())
 
+    def test_get_stop_the_world_stats(self):
+        import threading
+        keys = {'count', 'total_time_to_stop', 'max_time_to_stop',
+                'total_pause', 'max_pause', 'last_time_to_stop',
+                'last_pause', 'last_requester_id', 'last_slowest_thread_id'}
+        stats = sys._get_stop_the_world_stats()
+        self.assertEqual(stats.keys(), keys | {'global'})
+        self.assertEqual(stats['global'].keys(), keys)
+
+        gc.collect()
+        stats = sys._get_stop_the_world_stats()
+        if support.Py_GIL_DISABLED:
+            # The garbage collector stops the world.
+            self.assertGreaterEqual(stats['count'], 1)
+            self.assertEqual(stats['last_requester_id'],
+                             threading.get_ident())
+            self.assertGreaterEqual(stats['max_pause'], stats['last_pause'])
+            self.assertGreaterEqual(stats['total_pause'], stats['max_pause'])
+            self.assertGreaterEqual(stats['max_time_to_stop'],
+                                    stats['last_time_to_stop'])
+        else:
+            self.assertEqual(stats['count'], 0)
+            self.assertEqual(stats['total_pause'], 0.0)
+            self.assertEqual(stats['global']['count'], 0)
+
     def test_is_finalizing(self):
         self.assertIs(sys.is_finalizing(), False)
         # Don't use the atexit module because _Py_Finalizing is only set
@@ -1888,7 +1913,7 @@ def test_pythontypes(self):
         check = self.check_sizeof
         # _ast.AST
         import _ast
-        check(_ast.AST(), size('P'))
+        check(_ast.AST(), size('3P'))
         try:
             raise TypeError
         except TypeError as e:
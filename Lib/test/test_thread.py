@@ -404,6 +404,108 @@ class LockTests(lock_tests.LockTests):
     locktype = thread.allocate_lock
 
 
+class AtomicIntTests(unittest.TestCase):
+    def test_operations(self):
+        a = thread.AtomicInt()
+        self.assertEqual(a.load(), 0)
+        a.store(5)
+        self.assertEqual(a.load(), 5)
+        self.assertEqual(a.add(), 5)
+        self.assertEqual(a.add(-10), 6)
+        self.assertEqual(a.load(), -4)
+        self.assertEqual(a.exchange(7), -4)
+        self.assertFalse(a.compare_exchange(6, 1))
+        self.assertEqual(a.load(), 7)
+        self.assertTrue(a.compare_exchange(7, 1))
+        self.assertEqual(a.load(), 1)
+
+    def test_limits(self):
+        a = thread.AtomicInt(2**63 - 1)
+        self.assertEqual(a.add(), 2**63 - 1)
+        self.assertEqual(a.load(), -2**63)
+        self.assertRaises(OverflowError, thread.AtomicInt, 2**63)
+        self.assertRaises(OverflowError, a.store, -2**63 - 1)
+        self.assertRaises(TypeError, a.store, 1.0)
+        self.assertRaises(TypeError, a.add, "1")
+        self.assertEqual(a.load(), -2**63)
+
+    @threading_helper.requires_working_threading()
+    def test_concurrent_add(self):
+        a = thread.AtomicInt()
+        nthreads = 4
+        niter = 10_000
+
+        def worker():
+            for _ in range(niter):
+                a.add()
+
+        threading_helper.run_concurrently(worker, nthreads)
+        self.assertEqual(a.load(), nthreads * niter)
+
+
+class AtomicRefTests(unittest.TestCase):
+    def test_operations(self):
+        r = thread.AtomicRef()
+        self.assertIsNone(r.load())
+        x, y = object(), object()
+        r.store(x)
+        self.assertIs(r.load(), x)
+        self.assertIs(r.exchange(y), x)
+        self.assertFalse(r.compare_exchange(x, None))
+        self.assertIs(r.load(), y)
+        self.assertTrue(r.compare_exchange(y, x))
+        self.assertIs(r.load(), x)
+        self.assertIn(repr(x), repr(r))
+
+    def test_identity_comparison(self):
+        r = thread.AtomicRef(10**20)
+        self.assertFalse(r.compare_exchange(int("1" + "0" * 20), None))
+        self.assertEqual(r.load(), 10**20)
+
+    def test_refcounts(self):
+        class C:
+            pass
+        r = thread.AtomicRef(C())
+        wr = weakref.ref(r.load())
+        r.store(None)
+        support.gc_collect()
+        self.assertIsNone(wr())
+
+        obj = C()
+        r.store(obj)
+        r.compare_exchange(obj, C())
+        wr = weakref.ref(obj)
+        del obj
+        support.gc_collect()
+        self.assertIsNone(wr())
+
+    def test_cycle(self):
+        class C:
+            pass
+        c = C()
+        c.ref = thread.AtomicRef(c)
+        wr = weakref.ref(c)
+        del c
+        support.gc_collect()
+        self.assertIsNone(wr())
+
+    @threading_helper.requires_working_threading()
+    def test_concurrent_compare_exchange(self):
+        r = thread.AtomicRef(0)
+        nthreads = 4
+        niter = 2_000
+
+        def worker():
+            for _ in range(niter):
+                while True:
+                    old = r.load()
+                    if r.compare_exchange(old, old + 1):
+                        break
+
+        threading_helper.run_concurrently(worker, nthreads)
+        self.assertEqual(r.load(), nthreads * niter)
+
+
 class TestForkInThread(unittest.TestCase):
     def setUp(self):
         self.read_fd, self.write_fd = os.pipe()
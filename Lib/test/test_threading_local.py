@@ -224,9 +224,90 @@ def __eq__(self, other):
             loop.__setattr__(NameCompareTrue(), 2)
 
 
+    def test_many_locals(self):
+        # Values must not leak between objects, including objects created
+        # after others have been destroyed.
+        locals_ = [self._local() for _ in range(100)]
+        for i, loc in enumerate(locals_):
+            loc.value = i
+        del locals_[::2]
+        support.gc_collect()
+        locals_ += [self._local() for _ in range(50)]
+        for i, loc in enumerate(locals_):
+            if i < 50:
+                self.assertEqual(loc.value, 2 * i + 1)
+            else:
+                self.assertNotHasAttr(loc, 'value')
+
+    def test_thread_values_isolated(self):
+        loc = self._local()
+        loc.value = 'main'
+        seen = []
+
+        def f():
+            seen.append(hasattr(loc, 'value'))
+            loc.value = 'thread'
+            seen.append(loc.value)
+
+        for _ in range(3):
+            t = threading.Thread(target=f)
+            t.start()
+            t.join()
+        self.assertEqual(seen, [False, 'thread'] * 3)
+        self.assertEqual(loc.value, 'main')
+
+    def test_init_error_in_thread(self):
+        # A dict dropped after __init__ failed must not be found again.
+        class Local(self._local):
+            fail = False
+            def __init__(self):
+                self.x = 1
+                if Local.fail:
+                    raise ValueError
+
+        loc = Local()
+        results = []
+
+        def f():
+            Local.fail = True
+            try:
+                loc.x
+            except ValueError:
+                results.append('error')
+            Local.fail = False
+            garbage = [{'y': 0} for _ in range(100)]
+            results.append(loc.__dict__)
+
+        t = threading.Thread(target=f)
+        t.start()
+        t.join()
+        self.assertEqual(results, ['error', {'x': 1}])
+
+
 class ThreadLocalTest(unittest.TestCase, BaseLocalTest):
     _local = _thread._local
 
+    def test_access_from_finalizer_at_thread_exit(self):
+        loc = self._local()
+        results = []
+
+        class Finalizer:
+            def __del__(self):
+                # The locals dict of the exiting thread has already been
+                # removed, so it must not be found through the cache.
+                results.append(getattr(loc, 'value', None))
+
+        def f():
+            loc.value = 42
+            loc.finalizer = Finalizer()
+
+        t = threading.Thread(target=f)
+        t.start()
+        t.join()
+        support.gc_collect()
+        self.assertEqual(results, [None])
+
+
 class PyThreadingLocalTest(unittest.TestCase, BaseLocalTest):
     _local = _threading_local.local
 
@@ -754,6 +754,23 @@ def _testGetData(self):
         self.assertRaises(OSError, zi.get_data, os.path.join('a', 'b'))
         self.assertRaises(OSError, zi.get_data, os.path.join(TEMP_ZIP, 'a', 'b'))
 
+    def testGetDataShortReads(self):
+        # The raw file may return fewer bytes than requested.
+        class ShortFileIO(io.FileIO):
+            def read(self, size=-1):
+                return super().read(min(size, 7))
+
+        def open_code(path):
+            return io.BufferedReader(ShortFileIO(path))
+
+        self.addCleanup(os_helper.unlink, TEMP_ZIP)
+        data = bytes(range(256))
+        with ZipFile(TEMP_ZIP, 'w', compression=self.compression) as z:
+            z.writestr('testdata.dat', data)
+        zi = zipimport.zipimporter(TEMP_ZIP)
+        with unittest.mock.patch.object(zipimport._io, 'open_code', open_code):
+            self.assertEqual(zi.get_data('testdata.dat'), data)
+
     def testImporterAttr(self):
         src = """if 1:  # indent hack
         def get_file():
@@ -378,10 +378,25 @@ def _read_directory(archive):
             count = 0
             try:
                 fp.seek(header_position)
+                # Read the whole directory at once, rather than each of its
+                # records separately.
+                directory = fp.read(central_directory_size)
             except OSError:
                 raise ZipImportError(f"can't read Zip file: {archive!r}", path=archive)
+            if len(directory) != central_directory_size:
+                raise EOFError('EOF read where not expected')
+            directory_view = memoryview(directory)
+            pos = 0
             while True:
-                buffer = fp.read(46)
+                buffer = directory[pos:pos + 46]
+                if not buffer:
+                    # End of the central directory
+                    if count != num_entries:
+                        raise ZipImportError(
+                            f"mismatched num_entries: {count} should be {num_entries} in {archive!r}",
+                            path=archive,
+                        )
+                    break
                 if len(buffer) < 4:
                     raise EOFError('EOF read where not expected')
                 # Start of file header
@@ -394,36 +409,32 @@ def _read_directory(archive):
                     break                                # Bad: Central Dir File Header
                 if len(buffer) != 46:
                     raise EOFError('EOF read where not expected')
-                flags = _unpack_uint16(buffer[8:10])
-                compress = _unpack_uint16(buffer[10:12])
-                time = _unpack_uint16(buffer[12:14])
-                date = _unpack_uint16(buffer[14:16])
-                crc = _unpack_uint32(buffer[16:20])
-                data_size = _unpack_uint32(buffer[20:24])
-                file_size = _unpack_uint32(buffer[24:28])
-                name_size = _unpack_uint16(buffer[28:30])
-                extra_size = _unpack_uint16(buffer[30:32])
-                comment_size = _unpack_uint16(buffer[32:34])
-                file_offset = _unpack_uint32(buffer[42:46])
+                # Unpack all little-endian fields of the header from a single
+                # integer; the shifts are the byte offsets times 8.
+                header = int.from_bytes(buffer, 'little')
+                flags = header >> 64 & 0xffff
+                compress = header >> 80 & 0xffff
+                time = header >> 96 & 0xffff
+                date = header >> 112 & 0xffff
+                crc = header >> 128 & MAX_UINT32
+                data_size = header >> 160 & MAX_UINT32
+                file_size = header >> 192 & MAX_UINT32
+                name_size = header >> 224 & 0xffff
+                extra_size = header >> 240 & 0xffff
+                comment_size = header >> 256 & 0xffff
+                file_offset = header >> 336
                 header_size = name_size + extra_size + comment_size
+                pos += 46
 
-                try:
-                    name = fp.read(name_size)
-                except OSError:
-                    raise ZipImportError(f"can't read Zip file: {archive!r}", path=archive)
+                name = directory[pos:pos + name_size]
                 if len(name) != name_size:
                     raise ZipImportError(f"can't read Zip file: {archive!r}", path=archive)
-                # On Windows, calling fseek to skip over the fields we don't use is
-                # slower than reading the data because fseek flushes stdio's
-                # internal buffers.    See issue #8745.
-                try:
-                    extra_data_len = header_size - name_size
-                    extra_data = memoryview(fp.read(extra_data_len))
-
-                    if len(extra_data) != extra_data_len:
-                        raise ZipImportError(f"can't read Zip file: {archive!r}", path=archive)
-                except OSError:
+                pos += name_size
+                extra_data_len = header_size - name_size
+                extra_data = directory_view[pos:pos + extra_data_len]
+                if len(extra_data) != extra_data_len:
                     raise ZipImportError(f"can't read Zip file: {archive!r}", path=archive)
+                pos += extra_data_len
 
                 if flags & 0x800:
                     # UTF-8 file names extension
@@ -628,6 +639,20 @@ def _zstd_decompress(data):
     return b"".join(results)
 
 
+# Read size bytes from a raw file, which may return fewer bytes than
+# requested per call.  Return fewer bytes only at the end of the file.
+def _read_exactly(fp, size):
+    data = fp.read(size)
+    if len(data) == size:
+        return data
+    chunks = [data]
+    while data and size > len(data):
+        size -= len(data)
+        data = fp.read(size)
+        chunks.append(data)
+    return b''.join(chunks)
+
+
 # Given a path to a Zip file and a toc_entry, return the (uncompressed) data.
 def _get_data(archive, toc_entry):
     datapath, compress, data_size, file_size, file_offset, time, date, crc = toc_entry
@@ -635,12 +660,15 @@ def _get_data(archive, toc_entry):
         raise ZipImportError('negative data size')
 
     with _io.open_code(archive) as fp:
+        # Read from the raw file, if any: a buffered reader would fill its
+        # whole buffer for the small header read below.
+        fp = getattr(fp, 'raw', fp)
         # Check to make sure the local file header is correct
         try:
             fp.seek(file_offset)
         except OSError:
             raise ZipImportError(f"can't read Zip file: {archive!r}", path=archive)
-        buffer = fp.read(30)
+        buffer = _read_exactly(fp, 30)
         if len(buffer) != 30:
             raise EOFError('EOF read where not expected')
 
@@ -656,7 +684,7 @@ def _get_data(archive, toc_entry):
             fp.seek(file_offset)
         except OSError:
             raise ZipImportError(f"can't read Zip file: {archive!r}", path=archive)
-        raw_data = fp.read(data_size)
+        raw_data = _read_exactly(fp, data_size)
         if len(raw_data) != data_size:
             raise OSError("zipimport: can't read data")
 
@@ -7,6 +7,10 @@
 
 #include "Python.h"
 #include "pycore_crossinterp.h"   // _PyXIData_t
+#include "pycore_parking_lot.h"   // _PyParkingLot_Park()
+#include "pycore_pythread.h"      // PyThread_ParseTimeoutArg()
+#include "pycore_time.h"          // _PyDeadline_Init()
+#include "pycore_tuple.h"         // _PyTuple_ITEMS()
 
 #define REGISTERS_HEAP_TYPES
 #define HAS_FALLBACK
@@ -522,9 +526,17 @@ typedef struct _queue {
     Py_ssize_t num_waiters;  // protected by global lock
     PyThread_type_lock mutex;
     int alive;
+    // Set while threads are blocked until an item is added (has_getters)
+    // or removed (has_putters).  The threads park on these addresses,
+    // which works across interpreters.
+    uint8_t has_getters;
+    uint8_t has_putters;
     struct _queueitems {
         Py_ssize_t maxsize;
         Py_ssize_t count;
+        // Items popped by queue_get_many() that may still be put back.
+        // They keep their space in the queue until then.
+        Py_ssize_t reserved;
         _queueitem *first;
         _queueitem *last;
     } items;
@@ -566,6 +578,17 @@ _queue_clear(_queue *queue)
 
 static void _queue_free(_queue *);
 
+// Wake up the threads blocked on the flag, if any.
+// The queue mutex must be held.
+static void
+_queue_notify(uint8_t *p_flag)
+{
+    if (_Py_atomic_load_uint8_relaxed(p_flag)) {
+        _Py_atomic_store_uint8(p_flag, 0);
+        _PyParkingLot_UnparkAll(p_flag);
+    }
+}
+
 static void
 _queue_kill_and_wait(_queue *queue)
 {
@@ -573,13 +596,24 @@ _queue_kill_and_wait(_queue *queue)
     PyThread_acquire_lock(queue->mutex, WAIT_LOCK);
     assert(queue->alive);
     queue->alive = 0;
+    // The blocked threads will find the queue dead and stop waiting.
+    _queue_notify(&queue->has_getters);
+    _queue_notify(&queue->has_putters);
     PyThread_release_lock(queue->mutex);
 
-    // Wait for all waiters to fail.
+    // Wait for all waiters to fail.  The blocked ones must attach their
+    // thread state first, so we must not keep the GIL while we wait.
+    PyThreadState *tstate = PyThreadState_GetUnchecked();
+    if (tstate != NULL) {
+        (void)PyEval_SaveThread();
+    }
     while (queue->num_waiters > 0) {
         PyThread_acquire_lock(queue->mutex, WAIT_LOCK);
         PyThread_release_lock(queue->mutex);
     };
+    if (tstate != NULL) {
+        PyEval_RestoreThread(tstate);
+    }
 }
 
 static void
@@ -628,9 +662,53 @@ _queue_unlock(_queue *queue)
     PyThread_release_lock(queue->mutex);
 }
 
+// Unlock the queue and block until _queue_notify() is called on the flag
+// or the deadline passes.  Return 0 when woken up (the condition must be
+// checked again), "timeout_err" if the deadline passed, and -1 if a signal
+// handler raised an exception.
 static int
-_queue_add(_queue *queue, int64_t interpid, _PyXIData_t *data, int unboundop)
+_queue_wait(_queue *queue, uint8_t *p_flag,
+            PY_TIMEOUT_T timeout, PyTime_t deadline, int timeout_err)
+{
+    assert(timeout != 0);
+    PyTime_t wait = -1;
+    if (timeout > 0) {
+        wait = _PyDeadline_Get(deadline);
+        if (wait <= 0) {
+            _queue_unlock(queue);
+            return timeout_err;
+        }
+    }
+    uint8_t expected = 1;
+    _Py_atomic_store_uint8(p_flag, expected);
+    _queue_unlock(queue);
+
+    int res = _PyParkingLot_Park(p_flag, &expected, sizeof(*p_flag),
+                                 wait, NULL, 1);
+    if (res == Py_PARK_INTR && Py_MakePendingCalls() < 0) {
+        return -1;
+    }
+    // On timeout, the caller checks the queue one last time.
+    return 0;
+}
+
+static PyTime_t
+_queue_deadline(PY_TIMEOUT_T timeout)
 {
+    return timeout > 0 ? _PyDeadline_Init(timeout) : 0;
+}
+
+// Add the data to the queue, in order.  If the queue is full, wait for
+// free space until the timeout expires (0 means no wait, and a negative
+// timeout waits forever).  "*p_added" is set to the number of items added,
+// even on failure; the caller is responsible for the rest of the data.
+static int
+_queue_add(_queue *queue, int64_t interpid,
+           _PyXIData_t **datas, Py_ssize_t count, int unboundop,
+           PY_TIMEOUT_T timeout, Py_ssize_t *p_added)
+{
+    *p_added = 0;
+    PyTime_t deadline = _queue_deadline(timeout);
     int err = _queue_lock(queue);
     if (err < 0) {
         return err;
@@ -640,56 +718,161 @@ _queue_add(_queue *queue, int64_t interpid, _PyXIData_t *data, int unboundop)
     if (maxsize <= 0) {
         maxsize = PY_SSIZE_T_MAX;
     }
-    if (queue->items.count >= maxsize) {
-        _queue_unlock(queue);
-        return ERR_QUEUE_FULL;
-    }
+    Py_ssize_t added = 0;
+    while (added < count) {
+        if (queue->items.count + queue->items.reserved >= maxsize) {
+            if (added > 0) {
+                // Let the getters make room.
+                _queue_notify(&queue->has_getters);
+            }
+            if (timeout == 0) {
+                err = ERR_QUEUE_FULL;
+                break;
+            }
+            err = _queue_wait(queue, &queue->has_putters,
+                              timeout, deadline, ERR_QUEUE_FULL);
+            if (err == 0) {
+                err = _queue_lock(queue);
+            }
+            if (err < 0) {
+                *p_added = added;
+                return err;
+            }
+            if (timeout > 0 && _PyDeadline_Get(deadline) <= 0
+                && queue->items.count + queue->items.reserved >= maxsize)
+            {
+                err = ERR_QUEUE_FULL;
+                break;
+            }
+            continue;
+        }
 
-    _queueitem *item = _queueitem_new(interpid, data, unboundop);
-    if (item == NULL) {
-        _queue_unlock(queue);
-        return -1;
+        _queueitem *item = _queueitem_new(interpid, datas[added], unboundop);
+        if (item == NULL) {
+            err = -1;
+            break;
+        }
+        queue->items.count += 1;
+        if (queue->items.first == NULL) {
+            queue->items.first = item;
+        }
+        else {
+            queue->items.last->next = item;
+        }
+        queue->items.last = item;
+        added += 1;
     }
 
-    queue->items.count += 1;
-    if (queue->items.first == NULL) {
-        queue->items.first = item;
+    if (added > 0) {
+        _queue_notify(&queue->has_getters);
     }
-    else {
-        queue->items.last->next = item;
-    }
-    queue->items.last = item;
-
     _queue_unlock(queue);
-    return 0;
+    *p_added = added;
+    return err;
 }
 
+// Pop up to "maxitems" items off the front of the queue, waiting for
+// at least one item like _queue_add() waits for free space.  The popped
+// items are returned as a linked list.  If "reserve" is set, their space
+// stays reserved until _queue_unreserve() is called.
 static int
-_queue_next(_queue *queue, _PyXIData_t **p_data, int *p_unboundop)
+_queue_next(_queue *queue, Py_ssize_t maxitems, PY_TIMEOUT_T timeout,
+            int reserve, _queueitem **p_items, Py_ssize_t *p_popped)
 {
+    assert(maxitems > 0);
+    PyTime_t deadline = _queue_deadline(timeout);
     int err = _queue_lock(queue);
     if (err < 0) {
         return err;
     }
 
     assert(queue->items.count >= 0);
-    _queueitem *item = queue->items.first;
-    if (item == NULL) {
-        _queue_unlock(queue);
-        return ERR_QUEUE_EMPTY;
+    while (queue->items.first == NULL) {
+        if (timeout == 0) {
+            _queue_unlock(queue);
+            return ERR_QUEUE_EMPTY;
+        }
+        err = _queue_wait(queue, &queue->has_getters,
+                          timeout, deadline, ERR_QUEUE_EMPTY);
+        if (err == 0) {
+            err = _queue_lock(queue);
+        }
+        if (err < 0) {
+            return err;
+        }
+        if (queue->items.first == NULL
+            && timeout > 0 && _PyDeadline_Get(deadline) <= 0)
+        {
+            _queue_unlock(queue);
+            return ERR_QUEUE_EMPTY;
+        }
+    }
+
+    _queueitem *first = queue->items.first;
+    _queueitem *last = first;
+    Py_ssize_t popped = 1;
+    while (popped < maxitems && last->next != NULL) {
+        last = last->next;
+        popped += 1;
     }
-    queue->items.first = item->next;
-    if (queue->items.last == item) {
+    queue->items.first = last->next;
+    if (queue->items.last == last) {
         queue->items.last = NULL;
     }
-    queue->items.count -= 1;
-
-    _queueitem_popped(item, p_data, p_unboundop);
+    last->next = NULL;
+    queue->items.count -= popped;
+    if (reserve) {
+        queue->items.reserved += popped;
+    }
+    else {
+        _queue_notify(&queue->has_putters);
+    }
 
     _queue_unlock(queue);
+    *p_items = first;
+    if (p_popped != NULL) {
+        *p_popped = popped;
+    }
     return 0;
 }
 
+// Release the space reserved for "popped" items by _queue_next(), putting
+// back "items", the ones that were not consumed.  They go back to the front
+// of the queue, in their original order, so they are still the next items
+// of the queue.  Getters that ran meanwhile may have returned items which
+// were put after them.
+static void
+_queue_unreserve(_queue *queue, Py_ssize_t popped, _queueitem *items)
+{
+    if (_queue_lock(queue) < 0) {
+        // The queue was destroyed meanwhile.
+        _queueitem_free_all(items);
+        return;
+    }
+    assert(queue->items.reserved >= popped);
+    queue->items.reserved -= popped;
+    Py_ssize_t count = 0;
+    if (items != NULL) {
+        _queueitem *last = items;
+        count = 1;
+        while (last->next != NULL) {
+            last = last->next;
+            count += 1;
+        }
+        last->next = queue->items.first;
+        if (queue->items.first == NULL) {
+            queue->items.last = last;
+        }
+        queue->items.first = items;
+        queue->items.count += count;
+        _queue_notify(&queue->has_getters);
+    }
+    if (count < popped) {
+        _queue_notify(&queue->has_putters);
+    }
+    _queue_unlock(queue);
+}
+
 static int
 _queue_get_maxsize(_queue *queue, Py_ssize_t *p_maxsize)
 {
@@ -712,10 +895,10 @@ _queue_is_full(_queue *queue, int *p_is_full)
         return err;
     }
 
-    assert(queue->items.maxsize <= 0
-           || queue->items.count <= queue->items.maxsize);
+    Py_ssize_t used = queue->items.count + queue->items.reserved;
+    assert(queue->items.maxsize <= 0 || used <= queue->items.maxsize);
     *p_is_full = queue->items.maxsize > 0
-        ? queue->items.count == queue->items.maxsize
+        ? used == queue->items.maxsize
         : 0;
 
     _queue_unlock(queue);
@@ -769,6 +952,9 @@ _queue_clear_interpreter(_queue *queue, int64_t interpid)
             prev = item;
         }
     }
+    // Fix the tail, which may have been removed.
+    queue->items.last = prev;
+    _queue_notify(&queue->has_putters);
 
     _queue_unlock(queue);
 }
@@ -1121,10 +1307,11 @@ queue_destroy(_queues *queues, int64_t qid)
     return 0;
 }
 
-// Push an object onto the queue.
+// Push objects onto the queue, in order.
 static int
-queue_put(_queues *queues, int64_t qid, PyObject *obj, unboundop_t unboundop,
-          xidata_fallback_t fallback)
+queue_put(_queues *queues, int64_t qid, PyObject *const *objs,
+          Py_ssize_t count, unboundop_t unboundop,
+          xidata_fallback_t fallback, PY_TIMEOUT_T timeout)
 {
     PyThreadState *tstate = PyThreadState_Get();
 
@@ -1136,38 +1323,93 @@ queue_put(_queues *queues, int64_t qid, PyObject *obj, unboundop_t unboundop,
     }
     assert(queue != NULL);
 
-    // Convert the object to cross-interpreter data.
-    _PyXIData_t *xidata = _PyXIData_New();
-    if (xidata == NULL) {
-        _queue_unmark_waiter(queue, queues->mutex);
-        return -1;
+    _PyXIData_t *single = NULL;
+    _PyXIData_t **datas = &single;
+    if (count > 1) {
+        datas = PyMem_New(_PyXIData_t *, count);
+        if (datas == NULL) {
+            _queue_unmark_waiter(queue, queues->mutex);
+            PyErr_NoMemory();
+            return -1;
+        }
     }
-    if (_PyObject_GetXIData(tstate, obj, fallback, xidata) != 0) {
-        _queue_unmark_waiter(queue, queues->mutex);
-        GLOBAL_FREE(xidata);
-        return -1;
+
+    // Convert the objects to cross-interpreter data.
+    Py_ssize_t converted = 0;
+    int res = 0;
+    for (; converted < count; converted++) {
+        _PyXIData_t *xidata = _PyXIData_New();
+        if (xidata == NULL) {
+            res = -1;
+            break;
+        }
+        if (_PyObject_GetXIData(tstate, objs[converted], fallback, xidata) != 0) {
+            GLOBAL_FREE(xidata);
+            res = -1;
+            break;
+        }
+        assert(_PyXIData_INTERPID(xidata) ==
+                PyInterpreterState_GetID(tstate->interp));
+        datas[converted] = xidata;
     }
-    assert(_PyXIData_INTERPID(xidata) ==
-            PyInterpreterState_GetID(tstate->interp));
 
     // Add the data to the queue.
-    int64_t interpid = -1;  // _queueitem_init() will set it.
-    int res = _queue_add(queue, interpid, xidata, unboundop);
+    Py_ssize_t added = 0;
+    if (res == 0) {
+        int64_t interpid = -1;  // _queueitem_init() will set it.
+        res = _queue_add(queue, interpid, datas, count, unboundop,
+                         timeout, &added);
+    }
     _queue_unmark_waiter(queue, queues->mutex);
-    if (res != 0) {
+
+    // Release the data that did not make it into the queue.
+    for (Py_ssize_t i = added; i < converted; i++) {
         // We may chain an exception here:
-        (void)_release_xid_data(xidata, 0);
-        GLOBAL_FREE(xidata);
-        return res;
+        (void)_release_xid_data(datas[i], XID_IGNORE_EXC | XID_FREE);
+    }
+    if (datas != &single) {
+        PyMem_Free(datas);
+    }
+    return res;
+}
+
+// Convert a popped item back to an object and free the item.
+// "*p_obj" is set to NULL if the item is unbound.
+static int
+_queueitem_get_object(_queueitem *item, PyObject **p_obj, int *p_unboundop)
+{
+    *p_obj = NULL;
+    _PyXIData_t *data = NULL;
+    _queueitem_popped(item, &data, p_unboundop);
+    if (data == NULL) {
+        assert(!PyErr_Occurred());
+        return 0;
+    }
+
+    // Convert the data back to an object.
+    PyObject *obj = _PyXIData_NewObject(data);
+    if (obj == NULL) {
+        assert(PyErr_Occurred());
+        // It was allocated in queue_put(), so we free it.
+        (void)_release_xid_data(data, XID_IGNORE_EXC | XID_FREE);
+        return -1;
+    }
+    // It was allocated in queue_put(), so we free it.
+    int release_res = _release_xid_data(data, XID_FREE);
+    if (release_res < 0) {
+        // The source interpreter has been destroyed already.
+        assert(PyErr_Occurred());
+        Py_DECREF(obj);
+        return -1;
     }
 
+    *p_obj = obj;
     return 0;
 }
 
-// Pop the next object off the queue.  Fail if empty.
-// XXX Support a "wait" mutex?
+// Pop the next object off the queue.  Fail if empty after the timeout.
 static int
-queue_get(_queues *queues, int64_t qid,
+queue_get(_queues *queues, int64_t qid, PY_TIMEOUT_T timeout,
           PyObject **res, int *p_unboundop)
 {
     int err;
@@ -1183,36 +1425,140 @@ queue_get(_queues *queues, int64_t qid,
     assert(queue != NULL);
 
     // Pop off the next item from the queue.
-    _PyXIData_t *data = NULL;
-    err = _queue_next(queue, &data, p_unboundop);
+    _queueitem *item = NULL;
+    err = _queue_next(queue, 1, timeout, 0, &item, NULL);
     _queue_unmark_waiter(queue, queues->mutex);
     if (err != 0) {
         return err;
     }
-    else if (data == NULL) {
-        assert(!PyErr_Occurred());
-        return 0;
-    }
+    assert(item->next == NULL);
+    return _queueitem_get_object(item, res, p_unboundop);
+}
 
-    // Convert the data back to an object.
-    PyObject *obj = _PyXIData_NewObject(data);
+static PyObject *
+_queue_get_result(PyObject *obj, int unboundop)
+{
     if (obj == NULL) {
-        assert(PyErr_Occurred());
-        // It was allocated in queue_put(), so we free it.
-        (void)_release_xid_data(data, XID_IGNORE_EXC | XID_FREE);
-        return -1;
+        return Py_BuildValue("Oi", Py_None, unboundop);
     }
-    // It was allocated in queue_put(), so we free it.
-    int release_res = _release_xid_data(data, XID_FREE);
-    if (release_res < 0) {
-        // The source interpreter has been destroyed already.
+    PyObject *res = Py_BuildValue("OO", obj, Py_None);
+    Py_DECREF(obj);
+    return res;
+}
+
+// Pop up to "maxitems" objects off the queue, as a list of
+// (object, unbound op) pairs.  Fail if empty after the timeout.
+//
+// All the items are converted to objects before any of them is released,
+// so that no item is lost on failure.  If converting an item fails with an
+// ordinary exception, the objects converted before it are returned, and it
+// stays in the queue: the next get reports the error.  If it is the first
+// item, it is dropped like in queue_get().  On any other error, such as
+// MemoryError or KeyboardInterrupt, all the items are put back.
+static int
+queue_get_many(_queues *queues, int64_t qid, Py_ssize_t maxitems,
+               PY_TIMEOUT_T timeout, PyObject **res)
+{
+    int err;
+    *res = NULL;
+
+    // Look up the queue.
+    _queue *queue = NULL;
+    err = _queues_lookup(queues, qid, &queue);
+    if (err != 0) {
+        return err;
+    }
+    assert(queue != NULL);
+
+    _queueitem *items = NULL;
+    Py_ssize_t popped = 0;
+    err = _queue_next(queue, maxitems, timeout, 1, &items, &popped);
+    if (err != 0) {
+        _queue_unmark_waiter(queue, queues->mutex);
+        return err;
+    }
+
+    PyObject *list = PyList_New(0);
+    if (list == NULL) {
+        goto error;
+    }
+    _queueitem *item = items;
+    int conversion_failed = 0;
+    for (; item != NULL; item = item->next) {
+        PyObject *obj = NULL;
+        if (item->data != NULL) {
+            obj = _PyXIData_NewObject(item->data);
+            if (obj == NULL) {
+                conversion_failed = 1;
+                break;
+            }
+        }
+        PyObject *pair = _queue_get_result(obj, item->unboundop);
+        if (pair == NULL) {
+            break;
+        }
+        int appended = PyList_Append(list, pair);
+        Py_DECREF(pair);
+        if (appended < 0) {
+            break;
+        }
+    }
+
+    Py_ssize_t converted = PyList_GET_SIZE(list);
+    if (item != NULL) {
         assert(PyErr_Occurred());
-        Py_DECREF(obj);
-        return -1;
+        int item_error = (conversion_failed
+                          && PyErr_ExceptionMatches(PyExc_Exception)
+                          && !PyErr_ExceptionMatches(PyExc_MemoryError));
+        if (!item_error) {
+            goto error;
+        }
+        if (converted > 0) {
+            // Converting the item again will raise the error.
+            PyErr_Clear();
+        }
+        else {
+            // Like queue_get(), drop the item.
+            assert(item == items);
+            items = item->next;
+            item->next = NULL;
+            _PyXIData_t *data = NULL;
+            unboundop_t unboundop;
+            _queueitem_popped(item, &data, &unboundop);
+            (void)_release_xid_data(data, XID_IGNORE_EXC | XID_FREE);
+            _queue_unreserve(queue, popped, items);
+            _queue_unmark_waiter(queue, queues->mutex);
+            Py_DECREF(list);
+            return -1;
+        }
     }
 
-    *res = obj;
+    // Release the data of the converted items.
+    for (Py_ssize_t i = 0; i < converted; i++) {
+        item = items;
+        items = item->next;
+        _PyXIData_t *data = NULL;
+        unboundop_t unboundop;
+        _queueitem_popped(item, &data, &unboundop);
+        if (data != NULL) {
+            // It was allocated in queue_put(), so we free it.  The object
+            // is already converted, so it is returned even if the source
+            // interpreter has been destroyed meanwhile.
+            (void)_release_xid_data(data, XID_IGNORE_EXC | XID_FREE);
+        }
+    }
+    _queue_unreserve(queue, popped, items);
+    _queue_unmark_waiter(queue, queues->mutex);
+
+    *res = list;
     return 0;
+
+error:
+    // Put all the items back.
+    _queue_unreserve(queue, popped, items);
+    _queue_unmark_waiter(queue, queues->mutex);
+    Py_XDECREF(list);
+    return -1;
 }
 
 static int
@@ -1607,39 +1953,63 @@ _interpqueues_list_all_impl(PyObject *module)
     return ids;
 }
 
+static int
+resolve_put_args(PyObject *module, int64_t qid, int unboundarg,
+                 int fallbackarg, int blocking, PyObject *timeout_obj,
+                 unboundop_t *p_unboundop, xidata_fallback_t *p_fallback,
+                 PY_TIMEOUT_T *p_timeout)
+{
+    struct _queuedefaults defaults = {-1, -1};
+    if (unboundarg < 0 || fallbackarg < 0) {
+        int err = queue_get_defaults(&_globals.queues, qid, &defaults);
+        if (handle_queue_error(err, module, qid)) {
+            return -1;
+        }
+    }
+    if (resolve_unboundop(unboundarg, defaults.unboundop, p_unboundop) < 0) {
+        return -1;
+    }
+    if (resolve_fallback(fallbackarg, defaults.fallback, p_fallback) < 0) {
+        return -1;
+    }
+    return PyThread_ParseTimeoutArg(timeout_obj, blocking, p_timeout);
+}
+
 /*[clinic input]
 _interpqueues.put
     qid: qidarg
     obj: object
     unboundop as unboundarg: int = -1
     fallback as fallbackarg: int = -1
+    *
+    blocking: bool = False
+    timeout as timeout_obj: object = None
 
 Add the object's data to the queue.
+
+If blocking is true, wait while the queue is full, for at most timeout
+seconds if it is not None.
 [clinic start generated code]*/
 
 static PyObject *
 _interpqueues_put_impl(PyObject *module, int64_t qid, PyObject *obj,
-                       int unboundarg, int fallbackarg)
-/*[clinic end generated code: output=2e0b31c6eaec29c9 input=4906550ab5c73be3]*/
+                       int unboundarg, int fallbackarg, int blocking,
+                       PyObject *timeout_obj)
+/*[clinic end generated code: output=e57eb7d4872d9849 input=0871e416b742138d]*/
 {
-    struct _queuedefaults defaults = {-1, -1};
-    if (unboundarg < 0 || fallbackarg < 0) {
-        int err = queue_get_defaults(&_globals.queues, qid, &defaults);
-        if (handle_queue_error(err, module, qid)) {
-            return NULL;
-        }
-    }
     unboundop_t unboundop;
-    if (resolve_unboundop(unboundarg, defaults.unboundop, &unboundop) < 0) {
-        return NULL;
-    }
     xidata_fallback_t fallback;
-    if (resolve_fallback(fallbackarg, defaults.fallback, &fallback) < 0) {
+    PY_TIMEOUT_T timeout;
+    if (resolve_put_args(module, qid, unboundarg, fallbackarg,
+                         blocking, timeout_obj,
+                         &unboundop, &fallback, &timeout) < 0)
+    {
         return NULL;
     }
 
     /* Queue up the object. */
-    int err = queue_put(&_globals.queues, qid, obj, unboundop, fallback);
+    int err = queue_put(&_globals.queues, qid, &obj, 1,
+                        unboundop, fallback, timeout);
     // This is the only place that raises QueueFull.
     if (handle_queue_error(err, module, qid)) {
         return NULL;
@@ -1648,32 +2018,126 @@ _interpqueues_put_impl(PyObject *module, int64_t qid, PyObject *obj,
     Py_RETURN_NONE;
 }
 
+/*[clinic input]
+_interpqueues.put_many
+    qid: qidarg
+    objs: object
+    unboundop as unboundarg: int = -1
+    fallback as fallbackarg: int = -1
+    *
+    blocking: bool = False
+    timeout as timeout_obj: object = None
+
+Add the data of each object in the iterable to the queue, in order.
+
+This is like calling put() for each object, but the queue is locked once
+for all the objects that fit.  If the queue fills up, the objects that
+were added stay in the queue.
+[clinic start generated code]*/
+
+static PyObject *
+_interpqueues_put_many_impl(PyObject *module, int64_t qid, PyObject *objs,
+                            int unboundarg, int fallbackarg, int blocking,
+                            PyObject *timeout_obj)
+/*[clinic end generated code: output=cfa9239fae8d9510 input=b72f5f5fca537eb3]*/
+{
+    unboundop_t unboundop;
+    xidata_fallback_t fallback;
+    PY_TIMEOUT_T timeout;
+    if (resolve_put_args(module, qid, unboundarg, fallbackarg,
+                         blocking, timeout_obj,
+                         &unboundop, &fallback, &timeout) < 0)
+    {
+        return NULL;
+    }
+
+    PyObject *seq = PySequence_Tuple(objs);
+    if (seq == NULL) {
+        return NULL;
+    }
+    int err = 0;
+    Py_ssize_t count = PyTuple_GET_SIZE(seq);
+    if (count > 0) {
+        err = queue_put(&_globals.queues, qid, _PyTuple_ITEMS(seq), count,
+                        unboundop, fallback, timeout);
+    }
+    Py_DECREF(seq);
+    if (handle_queue_error(err, module, qid)) {
+        return NULL;
+    }
+
+    Py_RETURN_NONE;
+}
+
 /*[clinic input]
 _interpqueues.get
     qid: qidarg
+    *
+    blocking: bool = False
+    timeout as timeout_obj: object = None
 
 Return the (object, unbound op) from the front of the queue.
 
-If there is nothing to receive then raise QueueEmpty.
+If there is nothing to receive then raise QueueEmpty, unless blocking
+is true.  In that case, wait for an item, for at most timeout seconds
+if it is not None.
 [clinic start generated code]*/
 
 static PyObject *
-_interpqueues_get_impl(PyObject *module, int64_t qid)
-/*[clinic end generated code: output=b0988a0e29194f05 input=c5bccbc409ad0190]*/
+_interpqueues_get_impl(PyObject *module, int64_t qid, int blocking,
+                       PyObject *timeout_obj)
+/*[clinic end generated code: output=f79a9ac4f88c0178 input=c673a1347cf8452c]*/
 {
+    PY_TIMEOUT_T timeout;
+    if (PyThread_ParseTimeoutArg(timeout_obj, blocking, &timeout) < 0) {
+        return NULL;
+    }
+
     PyObject *obj = NULL;
     int unboundop = 0;
-    int err = queue_get(&_globals.queues, qid, &obj, &unboundop);
+    int err = queue_get(&_globals.queues, qid, timeout, &obj, &unboundop);
     // This is the only place that raises QueueEmpty.
     if (handle_queue_error(err, module, qid)) {
         return NULL;
     }
 
-    if (obj == NULL) {
-        return Py_BuildValue("Oi", Py_None, unboundop);
+    return _queue_get_result(obj, unboundop);
+}
+
+/*[clinic input]
+_interpqueues.get_many
+    qid: qidarg
+    maxitems: Py_ssize_t
+    *
+    blocking: bool = False
+    timeout as timeout_obj: object = None
+
+Return a list of up to maxitems (object, unbound op) from the queue.
+
+The list is never empty: it is like get() for the first item, and then
+takes the items available right away, without waiting.
+[clinic start generated code]*/
+
+static PyObject *
+_interpqueues_get_many_impl(PyObject *module, int64_t qid,
+                            Py_ssize_t maxitems, int blocking,
+                            PyObject *timeout_obj)
+/*[clinic end generated code: output=2ff4d622c424a994 input=1d0d77d83b3a2cef]*/
+{
+    if (maxitems <= 0) {
+        PyErr_SetString(PyExc_ValueError, "maxitems must be positive");
+        return NULL;
+    }
+    PY_TIMEOUT_T timeout;
+    if (PyThread_ParseTimeoutArg(timeout_obj, blocking, &timeout) < 0) {
+        return NULL;
+    }
+
+    PyObject *res = NULL;
+    int err = queue_get_many(&_globals.queues, qid, maxitems, timeout, &res);
+    if (handle_queue_error(err, module, qid)) {
+        return NULL;
     }
-    PyObject *res = Py_BuildValue("OO", obj, Py_None);
-    Py_DECREF(obj);
     return res;
 }
 
@@ -1854,7 +2318,9 @@ static PyMethodDef module_functions[] = {
     _INTERPQUEUES_DESTROY_METHODDEF
     _INTERPQUEUES_LIST_ALL_METHODDEF
     _INTERPQUEUES_PUT_METHODDEF
+    _INTERPQUEUES_PUT_MANY_METHODDEF
     _INTERPQUEUES_GET_METHODDEF
+    _INTERPQUEUES_GET_MANY_METHODDEF
     _INTERPQUEUES_BIND_METHODDEF
     _INTERPQUEUES_RELEASE_METHODDEF
     _INTERPQUEUES_GET_MAXSIZE_METHODDEF
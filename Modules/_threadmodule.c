@@ -3,6 +3,7 @@
 
 #include "Python.h"
 #include "pycore_fileutils.h"     // _PyFile_Flush
+#include "pycore_index_pool.h"    // _PyIndexPool_AllocIndex()
 #include "pycore_interp.h"        // _PyInterpreterState.threads.count
 #include "pycore_lock.h"
 #include "pycore_modsupport.h"    // _PyArg_NoKeywords()
@@ -11,6 +12,7 @@
 #include "pycore_pylifecycle.h"
 #include "pycore_pystate.h"       // _PyThreadState_SetCurrent()
 #include "pycore_time.h"          // _PyTime_FromSeconds()
+#include "pycore_tstate.h"        // _PyThreadStateImpl
 #include "pycore_weakref.h"       // _PyWeakref_GET_REF()
 
 #include <stddef.h>               // offsetof()
@@ -29,6 +31,8 @@ typedef struct {
     PyTypeObject *excepthook_type;
     PyTypeObject *lock_type;
     PyTypeObject *rlock_type;
+    PyTypeObject *atomic_int_type;
+    PyTypeObject *atomic_ref_type;
     PyTypeObject *local_type;
     PyTypeObject *local_dummy_type;
     PyTypeObject *thread_handle_type;
@@ -52,6 +56,20 @@ typedef struct {
 
 #define rlockobject_CAST(op)    ((rlockobject *)(op))
 
+typedef struct {
+    PyObject_HEAD
+    int64_t value;
+} atomicintobject;
+
+#define atomicintobject_CAST(op)    ((atomicintobject *)(op))
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *value;
+} atomicrefobject;
+
+#define atomicrefobject_CAST(op)    ((atomicrefobject *)(op))
+
 static inline thread_module_state*
 get_thread_state(PyObject *module)
 {
@@ -84,8 +102,10 @@ static PF_SET_THREAD_DESCRIPTION pSetThreadDescription = NULL;
 module _thread
 class _thread.lock "lockobject *" "clinic_state()->lock_type"
 class _thread.RLock "rlockobject *" "clinic_state()->rlock_type"
+class _thread.AtomicInt "atomicintobject *" "clinic_state()->atomic_int_type"
+class _thread.AtomicRef "atomicrefobject *" "clinic_state()->atomic_ref_type"
 [clinic start generated code]*/
-/*[clinic end generated code: output=da39a3ee5e6b4b0d input=c5a0f8c492a0c263]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=b81e539fe17be29f]*/
 
 #define clinic_state() get_thread_state_by_cls(type)
 #include "clinic/_threadmodule.c.h"
@@ -1354,6 +1374,377 @@ static PyType_Spec rlock_type_spec = {
     .slots = rlock_type_slots,
 };
 
+/* Atomic integer and reference objects */
+
+/* These wrap the _Py_atomic_* primitives so that counters and flags can be
+   shared between threads without a lock.  All operations are sequentially
+   consistent.  The methods are METH_NOARGS/METH_O/METH_FASTCALL method
+   descriptors, which the CALL instruction already specializes, so a call
+   in a hot loop goes straight to the atomic instruction. */
+
+static int
+atomic_int_from_object(PyObject *obj, int64_t *value)
+{
+    if (!PyLong_Check(obj)) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected an int, got %T", obj);
+        return -1;
+    }
+    return PyLong_AsInt64(obj, value);
+}
+
+/*[clinic input]
+@classmethod
+_thread.AtomicInt.__new__ as atomic_int_new
+    value: object(c_default="NULL") = 0
+
+A 64-bit integer that can be updated atomically from several threads.
+
+Arithmetic wraps around on overflow, as for a C int64_t.
+[clinic start generated code]*/
+
+static PyObject *
+atomic_int_new_impl(PyTypeObject *type, PyObject *value)
+/*[clinic end generated code: output=6f622704857f8eee input=33203709db8b64a7]*/
+{
+    int64_t initial = 0;
+    if (value != NULL && atomic_int_from_object(value, &initial) < 0) {
+        return NULL;
+    }
+    atomicintobject *self = (atomicintobject *)type->tp_alloc(type, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->value = initial;
+    return (PyObject *)self;
+}
+
+/*[clinic input]
+_thread.AtomicInt.load
+
+Return the current value.
+[clinic start generated code]*/
+
+static PyObject *
+_thread_AtomicInt_load_impl(atomicintobject *self)
+/*[clinic end generated code: output=c3b17f677d894913 input=741eb0d244ae6587]*/
+{
+    return PyLong_FromInt64(_Py_atomic_load_int64(&self->value));
+}
+
+/*[clinic input]
+_thread.AtomicInt.store
+    value: object
+    /
+
+Set the value.
+[clinic start generated code]*/
+
+static PyObject *
+_thread_AtomicInt_store_impl(atomicintobject *self, PyObject *value)
+/*[clinic end generated code: output=1643aeaf0520eaec input=11837ada566befe6]*/
+{
+    int64_t v;
+    if (atomic_int_from_object(value, &v) < 0) {
+        return NULL;
+    }
+    _Py_atomic_store_int64(&self->value, v);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_thread.AtomicInt.exchange
+    value: object
+    /
+
+Set the value and return the previous value.
+[clinic start generated code]*/
+
+static PyObject *
+_thread_AtomicInt_exchange_impl(atomicintobject *self, PyObject *value)
+/*[clinic end generated code: output=dd61e953b07cd7b6 input=ac5be40a643024fe]*/
+{
+    int64_t v;
+    if (atomic_int_from_object(value, &v) < 0) {
+        return NULL;
+    }
+    return PyLong_FromInt64(_Py_atomic_exchange_int64(&self->value, v));
+}
+
+/*[clinic input]
+_thread.AtomicInt.add
+    delta: object(c_default="NULL") = 1
+    /
+
+Add delta to the value and return the previous value.
+[clinic start generated code]*/
+
+static PyObject *
+_thread_AtomicInt_add_impl(atomicintobject *self, PyObject *delta)
+/*[clinic end generated code: output=d0a1209607585a5b input=114fec8aabe07edf]*/
+{
+    int64_t d = 1;
+    if (delta != NULL && atomic_int_from_object(delta, &d) < 0) {
+        return NULL;
+    }
+    return PyLong_FromInt64(_Py_atomic_add_int64(&self->value, d));
+}
+
+/*[clinic input]
+_thread.AtomicInt.compare_exchange
+    expected: object
+    desired: object
+    /
+
+Set the value to desired if it is equal to expected.
+
+Return True if the value was replaced, False otherwise.
+[clinic start generated code]*/
+
+static PyObject *
+_thread_AtomicInt_compare_exchange_impl(atomicintobject *self,
+                                        PyObject *expected,
+                                        PyObject *desired)
+/*[clinic end generated code: output=1733d8fcbfeaba71 input=fb9ef772da7ce63d]*/
+{
+    int64_t e, d;
+    if (atomic_int_from_object(expected, &e) < 0) {
+        return NULL;
+    }
+    if (atomic_int_from_object(desired, &d) < 0) {
+        return NULL;
+    }
+    return PyBool_FromLong(
+        _Py_atomic_compare_exchange_int64(&self->value, &e, d));
+}
+
+static PyObject *
+atomic_int_repr(PyObject *op)
+{
+    atomicintobject *self = atomicintobject_CAST(op);
+    return PyUnicode_FromFormat("<%s object value=%lld at %p>",
+        Py_TYPE(self)->tp_name,
+        (long long)_Py_atomic_load_int64(&self->value), self);
+}
+
+static void
+atomic_int_dealloc(PyObject *self)
+{
+    PyTypeObject *tp = Py_TYPE(self);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+static PyMethodDef atomic_int_methods[] = {
+    _THREAD_ATOMICINT_LOAD_METHODDEF
+    _THREAD_ATOMICINT_STORE_METHODDEF
+    _THREAD_ATOMICINT_EXCHANGE_METHODDEF
+    _THREAD_ATOMICINT_ADD_METHODDEF
+    _THREAD_ATOMICINT_COMPARE_EXCHANGE_METHODDEF
+    {NULL,           NULL}              /* sentinel */
+};
+
+static PyType_Slot atomic_int_type_slots[] = {
+    {Py_tp_dealloc, atomic_int_dealloc},
+    {Py_tp_repr, atomic_int_repr},
+    {Py_tp_doc, (void *)atomic_int_new__doc__},
+    {Py_tp_methods, atomic_int_methods},
+    {Py_tp_new, atomic_int_new},
+    {0, 0},
+};
+
+static PyType_Spec atomic_int_type_spec = {
+    .name = "_thread.AtomicInt",
+    .basicsize = sizeof(atomicintobject),
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE,
+    .slots = atomic_int_type_slots,
+};
+
+/* The stored reference is read with _Py_XGetRef(), which is safe against
+   concurrent replacement as long as writers mark the stored object as
+   maybe-weakref. */
+
+static inline PyObject *
+atomic_ref_get(atomicrefobject *self)
+{
+#ifdef Py_GIL_DISABLED
+    return _Py_XGetRef(&self->value);
+#else
+    return Py_NewRef(self->value);
+#endif
+}
+
+static inline PyObject *
+atomic_ref_new_value(PyObject *value)
+{
+#ifdef Py_GIL_DISABLED
+    _PyObject_SetMaybeWeakref(value);
+#endif
+    return Py_NewRef(value);
+}
+
+/*[clinic input]
+@classmethod
+_thread.AtomicRef.__new__ as atomic_ref_new
+    value: object = None
+
+An object reference that can be replaced atomically from several threads.
+
+compare_exchange() compares objects by identity.
+[clinic start generated code]*/
+
+static PyObject *
+atomic_ref_new_impl(PyTypeObject *type, PyObject *value)
+/*[clinic end generated code: output=3a4e79f742d462b8 input=5f0860975f2942f4]*/
+{
+    atomicrefobject *self = (atomicrefobject *)type->tp_alloc(type, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->value = atomic_ref_new_value(value);
+    return (PyObject *)self;
+}
+
+/*[clinic input]
+_thread.AtomicRef.load
+
+Return the current object.
+[clinic start generated code]*/
+
+static PyObject *
+_thread_AtomicRef_load_impl(atomicrefobject *self)
+/*[clinic end generated code: output=9bb29a691c42261c input=38ac85265c99bd25]*/
+{
+    return atomic_ref_get(self);
+}
+
+/*[clinic input]
+_thread.AtomicRef.store
+    value: object
+    /
+
+Replace the current object.
+[clinic start generated code]*/
+
+static PyObject *
+_thread_AtomicRef_store_impl(atomicrefobject *self, PyObject *value)
+/*[clinic end generated code: output=a01b678f2d450220 input=5076f66ce62a9375]*/
+{
+    PyObject *old = _Py_atomic_exchange_ptr(&self->value,
+                                            atomic_ref_new_value(value));
+    Py_DECREF(old);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_thread.AtomicRef.exchange
+    value: object
+    /
+
+Replace the current object and return the previous one.
+[clinic start generated code]*/
+
+static PyObject *
+_thread_AtomicRef_exchange_impl(atomicrefobject *self, PyObject *value)
+/*[clinic end generated code: output=dcd0877c776a9b17 input=094db131f84eb1da]*/
+{
+    return _Py_atomic_exchange_ptr(&self->value, atomic_ref_new_value(value));
+}
+
+/*[clinic input]
+_thread.AtomicRef.compare_exchange
+    expected: object
+    desired: object
+    /
+
+Replace the current object with desired if it is expected.
+
+Return True if the object was replaced, False otherwise.
+[clinic start generated code]*/
+
+static PyObject *
+_thread_AtomicRef_compare_exchange_impl(atomicrefobject *self,
+                                        PyObject *expected,
+                                        PyObject *desired)
+/*[clinic end generated code: output=fff3ef3ed13d4d86 input=f272ff74f6d5aa22]*/
+{
+    PyObject *new_value = atomic_ref_new_value(desired);
+    PyObject *old = expected;
+    if (!_Py_atomic_compare_exchange_ptr(&self->value, &old, new_value)) {
+        Py_DECREF(new_value);
+        Py_RETURN_FALSE;
+    }
+    // The reference formerly owned by self->value.
+    Py_DECREF(old);
+    Py_RETURN_TRUE;
+}
+
+static PyObject *
+atomic_ref_repr(PyObject *op)
+{
+    atomicrefobject *self = atomicrefobject_CAST(op);
+    PyObject *value = atomic_ref_get(self);
+    PyObject *res = PyUnicode_FromFormat("<%s object value=%R at %p>",
+                                         Py_TYPE(self)->tp_name, value, self);
+    Py_DECREF(value);
+    return res;
+}
+
+static int
+atomic_ref_traverse(PyObject *op, visitproc visit, void *arg)
+{
+    atomicrefobject *self = atomicrefobject_CAST(op);
+    Py_VISIT(Py_TYPE(self));
+    Py_VISIT(self->value);
+    return 0;
+}
+
+static int
+atomic_ref_clear(PyObject *op)
+{
+    atomicrefobject *self = atomicrefobject_CAST(op);
+    PyObject *old = _Py_atomic_exchange_ptr(&self->value, Py_None);
+    Py_DECREF(old);
+    return 0;
+}
+
+static void
+atomic_ref_dealloc(PyObject *self)
+{
+    PyObject_GC_UnTrack(self);
+    PyTypeObject *tp = Py_TYPE(self);
+    Py_CLEAR(atomicrefobject_CAST(self)->value);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+static PyMethodDef atomic_ref_methods[] = {
+    _THREAD_ATOMICREF_LOAD_METHODDEF
+    _THREAD_ATOMICREF_STORE_METHODDEF
+    _THREAD_ATOMICREF_EXCHANGE_METHODDEF
+    _THREAD_ATOMICREF_COMPARE_EXCHANGE_METHODDEF
+    {NULL,           NULL}              /* sentinel */
+};
+
+static PyType_Slot atomic_ref_type_slots[] = {
+    {Py_tp_dealloc, atomic_ref_dealloc},
+    {Py_tp_repr, atomic_ref_repr},
+    {Py_tp_doc, (void *)atomic_ref_new__doc__},
+    {Py_tp_methods, atomic_ref_methods},
+    {Py_tp_traverse, atomic_ref_traverse},
+    {Py_tp_clear, atomic_ref_clear},
+    {Py_tp_new, atomic_ref_new},
+    {0, 0},
+};
+
+static PyType_Spec atomic_ref_type_spec = {
+    .name = "_thread.AtomicRef",
+    .basicsize = sizeof(atomicrefobject),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
+              Py_TPFLAGS_IMMUTABLETYPE),
+    .slots = atomic_ref_type_slots,
+};
+
 /* Thread-local objects */
 
 /* Quick overview:
@@ -1405,6 +1796,17 @@ static PyType_Spec rlock_type_spec = {
    be cleared before finalizers were called (GC currently clears weakrefs that
    are garbage before invoking finalizers), causing lookups in finalizers to
    fail.
+
+   Looking up the locals dict in `localdicts` on every attribute access is
+   slow, and contended when many threads share a `threading.local` object.
+   Each `threading.local` object is therefore assigned an index, from an
+   index pool of the interpreter, and a tag that is never reused.  Each thread
+   state has an array of (tag, borrowed locals dict) entries indexed by that
+   index, filled on the first lookup from the thread.  An entry is valid if
+   its tag matches the tag of the object: the borrowed dict stays alive as
+   long as both the thread-local object and the thread are, since it can only
+   be removed from `localdicts` by the death of one of them.  The thread state
+   drops its array before its sentinel is released.
 */
 
 typedef struct {
@@ -1454,6 +1856,10 @@ typedef struct {
     PyObject *localdicts;
     /* A set of weakrefs to thread sentinels localdummies*/
     PyObject *thread_watchdogs;
+    /* Index into the per-thread cache of locals dicts */
+    int32_t cache_index;
+    /* Unique tag validating cache entries, 0 once the object is cleared */
+    uint64_t cache_tag;
 } localobject;
 
 #define localobject_CAST(op)    ((localobject *)(op))
@@ -1534,6 +1940,14 @@ local_new(PyTypeObject *type, PyObject *args, PyObject *kw)
     self->args = Py_XNewRef(args);
     self->kw = Py_XNewRef(kw);
 
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    self->cache_index = _PyIndexPool_AllocIndex(&interp->threading_local_indices);
+    if (self->cache_index < 0) {
+        goto err;
+    }
+    self->cache_tag = _Py_atomic_add_uint64(
+        &interp->threading_local_next_tag, 1) + 1;
+
     self->localdicts = PyDict_New();
     if (self->localdicts == NULL) {
         goto err;
@@ -1575,6 +1989,9 @@ static int
 local_clear(PyObject *op)
 {
     localobject *self = localobject_CAST(op);
+    /* Invalidate the cache entries: the locals dicts are about to be
+       released. */
+    self->cache_tag = 0;
     Py_CLEAR(self->args);
     Py_CLEAR(self->kw);
     Py_CLEAR(self->localdicts);
@@ -1593,6 +2010,11 @@ local_dealloc(PyObject *op)
     }
     PyObject_GC_UnTrack(self);
     (void)local_clear(op);
+    if (self->cache_index >= 0) {
+        PyInterpreterState *interp = _PyInterpreterState_GET();
+        _PyIndexPool_FreeIndex(&interp->threading_local_indices,
+                               self->cache_index);
+    }
     PyTypeObject *tp = Py_TYPE(self);
     tp->tp_free(self);
     Py_DECREF(tp);
@@ -1685,6 +2107,69 @@ create_localsdict(localobject *self, thread_module_state *state,
     return -1;
 }
 
+/* Return a borrowed reference to the cached locals dict of the current
+   thread, or NULL if it is not cached. */
+static inline PyObject *
+local_cache_lookup(localobject *self)
+{
+    _PyThreadStateImpl *tstate = (_PyThreadStateImpl *)_PyThreadState_GET();
+    if (self->cache_index < tstate->threading_local_cache.size) {
+        struct _Py_threading_local_entry *entry =
+            &tstate->threading_local_cache.entries[self->cache_index];
+        if (entry->tag == self->cache_tag && self->cache_tag != 0) {
+            return entry->localdict;
+        }
+    }
+    return NULL;
+}
+
+/* Cache the locals dict of the current thread.  Caching is best effort:
+   if memory cannot be allocated, the dict is simply not cached. */
+static void
+local_cache_store(localobject *self, PyObject *ldict)
+{
+    if (self->cache_tag == 0) {
+        return;
+    }
+    _PyThreadStateImpl *tstate = (_PyThreadStateImpl *)_PyThreadState_GET();
+    Py_ssize_t size = tstate->threading_local_cache.size;
+    if (self->cache_index >= size) {
+        Py_ssize_t new_size = Py_MAX(8, size * 2);
+        while (new_size <= self->cache_index) {
+            new_size *= 2;
+        }
+        struct _Py_threading_local_entry *entries = PyMem_RawRealloc(
+            tstate->threading_local_cache.entries,
+            new_size * sizeof(struct _Py_threading_local_entry));
+        if (entries == NULL) {
+            return;
+        }
+        memset(entries + size, 0,
+               (new_size - size) * sizeof(struct _Py_threading_local_entry));
+        tstate->threading_local_cache.entries = entries;
+        tstate->threading_local_cache.size = new_size;
+    }
+    struct _Py_threading_local_entry *entry =
+        &tstate->threading_local_cache.entries[self->cache_index];
+    entry->tag = self->cache_tag;
+    entry->localdict = ldict;
+}
+
+/* Forget the cached locals dict of the current thread, if any. */
+static void
+local_cache_clear(localobject *self)
+{
+    _PyThreadStateImpl *tstate = (_PyThreadStateImpl *)_PyThreadState_GET();
+    if (self->cache_index < tstate->threading_local_cache.size) {
+        struct _Py_threading_local_entry *entry =
+            &tstate->threading_local_cache.entries[self->cache_index];
+        if (entry->tag == self->cache_tag) {
+            entry->tag = 0;
+            entry->localdict = NULL;
+        }
+    }
+}
+
 /* Return a strong reference to the locals dict for the current thread,
    creating it if necessary.
 */
@@ -1703,6 +2188,7 @@ _ldict(localobject *self, thread_module_state *state)
         return NULL;
     }
     if (ldict != NULL) {
+        local_cache_store(self, ldict);
         return ldict;
     }
 
@@ -1717,7 +2203,8 @@ _ldict(localobject *self, thread_module_state *state)
         Py_TYPE(self)->tp_init((PyObject *)self, self->args, self->kw) < 0) {
         /* we need to get rid of ldict from thread so
            we create a new one the next time we do an attr
-           access */
+           access.  __init__ may have cached it. */
+        local_cache_clear(self);
         PyObject *exc = PyErr_GetRaisedException();
         if (PyDict_DelItem(self->localdicts,
                            tstate->threading_local_key) < 0)
@@ -1737,6 +2224,7 @@ _ldict(localobject *self, thread_module_state *state)
     }
     Py_DECREF(wr);
 
+    local_cache_store(self, ldict);
     return ldict;
 }
 
@@ -1744,13 +2232,19 @@ static int
 local_setattro(PyObject *op, PyObject *name, PyObject *v)
 {
     localobject *self = localobject_CAST(op);
-    PyObject *module = PyType_GetModuleByDef(Py_TYPE(self), &thread_module);
-    assert(module != NULL);
-    thread_module_state *state = get_thread_state(module);
+    PyObject *ldict = local_cache_lookup(self);
+    if (ldict != NULL) {
+        Py_INCREF(ldict);
+    }
+    else {
+        PyObject *module = PyType_GetModuleByDef(Py_TYPE(self), &thread_module);
+        assert(module != NULL);
+        thread_module_state *state = get_thread_state(module);
 
-    PyObject *ldict = _ldict(self, state);
-    if (ldict == NULL) {
-        goto err;
+        ldict = _ldict(self, state);
+        if (ldict == NULL) {
+            goto err;
+        }
     }
 
     int r = PyObject_RichCompareBool(name, &_Py_ID(__dict__), Py_EQ);
@@ -1804,13 +2298,20 @@ static PyObject *
 local_getattro(PyObject *op, PyObject *name)
 {
     localobject *self = localobject_CAST(op);
-    PyObject *module = PyType_GetModuleByDef(Py_TYPE(self), &thread_module);
-    assert(module != NULL);
-    thread_module_state *state = get_thread_state(module);
+    PyObject *ldict = local_cache_lookup(self);
+    if (ldict != NULL) {
+        Py_INCREF(ldict);
+    }
+    else {
+        PyObject *module = PyType_GetModuleByDef(Py_TYPE(self), &thread_module);
+        assert(module != NULL);
+        thread_module_state *state = get_thread_state(module);
 
-    PyObject *ldict = _ldict(self, state);
-    if (ldict == NULL)
-        return NULL;
+        ldict = _ldict(self, state);
+        if (ldict == NULL) {
+            return NULL;
+        }
+    }
 
     int r = PyObject_RichCompareBool(name, &_Py_ID(__dict__), Py_EQ);
     if (r == 1) {
@@ -1821,7 +2322,9 @@ local_getattro(PyObject *op, PyObject *name)
         return NULL;
     }
 
-    if (!Py_IS_TYPE(self, state->local_type)) {
+    /* Only _thread._local itself derives directly from object; checking
+       this avoids looking up the module state. */
+    if (Py_TYPE(self)->tp_base != &PyBaseObject_Type) {
         /* use generic lookup for subtypes */
         PyObject *res = _PyObject_GenericGetAttrWithDict(op, name, ldict, 0);
         Py_DECREF(ldict);
@@ -2734,6 +3237,26 @@ thread_module_exec(PyObject *module)
         return -1;
     }
 
+    // AtomicInt
+    state->atomic_int_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &atomic_int_type_spec, NULL);
+    if (state->atomic_int_type == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(module, state->atomic_int_type) < 0) {
+        return -1;
+    }
+
+    // AtomicRef
+    state->atomic_ref_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &atomic_ref_type_spec, NULL);
+    if (state->atomic_ref_type == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(module, state->atomic_ref_type) < 0) {
+        return -1;
+    }
+
     // Local dummy
     state->local_dummy_type = (PyTypeObject *)PyType_FromSpec(&local_dummy_type_spec);
     if (state->local_dummy_type == NULL) {
@@ -2820,6 +3343,8 @@ thread_module_traverse(PyObject *module, visitproc visit, void *arg)
     Py_VISIT(state->excepthook_type);
     Py_VISIT(state->lock_type);
     Py_VISIT(state->rlock_type);
+    Py_VISIT(state->atomic_int_type);
+    Py_VISIT(state->atomic_ref_type);
     Py_VISIT(state->local_type);
     Py_VISIT(state->local_dummy_type);
     Py_VISIT(state->thread_handle_type);
@@ -2833,6 +3358,8 @@ thread_module_clear(PyObject *module)
     Py_CLEAR(state->excepthook_type);
     Py_CLEAR(state->lock_type);
     Py_CLEAR(state->rlock_type);
+    Py_CLEAR(state->atomic_int_type);
+    Py_CLEAR(state->atomic_ref_type);
     Py_CLEAR(state->local_type);
     Py_CLEAR(state->local_dummy_type);
     Py_CLEAR(state->thread_handle_type);
@@ -586,7 +586,7 @@ int LLVMFuzzerInitialize(int *argc, char ***argv) {
     PyConfig_InitPythonConfig(&config);
     config.install_signal_handlers = 0;
     /* Raise the limit above the default allows exercising larger things
-     * now that we fall back to the _pylong module for large values. */
+     * now that large values use subquadratic algorithms. */
     config.int_max_str_digits = 8086;
     PyStatus status;
     status = PyConfig_SetBytesString(&config, &config.program_name, *argv[0]);
@@ -186,17 +186,22 @@ _interpqueues_list_all(PyObject *module, PyObject *Py_UNUSED(ignored))
 }
 
 PyDoc_STRVAR(_interpqueues_put__doc__,
-"put($module, /, qid, obj, unboundop=-1, fallback=-1)\n"
+"put($module, /, qid, obj, unboundop=-1, fallback=-1, *, blocking=False,\n"
+"    timeout=None)\n"
 "--\n"
 "\n"
-"Add the object\'s data to the queue.");
+"Add the object\'s data to the queue.\n"
+"\n"
+"If blocking is true, wait while the queue is full, for at most timeout\n"
+"seconds if it is not None.");
 
 #define _INTERPQUEUES_PUT_METHODDEF    \
     {"put", _PyCFunction_CAST(_interpqueues_put), METH_FASTCALL|METH_KEYWORDS, _interpqueues_put__doc__},
 
 static PyObject *
 _interpqueues_put_impl(PyObject *module, int64_t qid, PyObject *obj,
-                       int unboundarg, int fallbackarg);
+                       int unboundarg, int fallbackarg, int blocking,
+                       PyObject *timeout_obj);
 
 static PyObject *
 _interpqueues_put(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
@@ -204,7 +209,7 @@ _interpqueues_put(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyO
     PyObject *return_value = NULL;
     #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
 
-    #define NUM_KEYWORDS 4
+    #define NUM_KEYWORDS 6
     static struct {
         PyGC_Head _this_is_not_used;
         PyObject_VAR_HEAD
@@ -213,7 +218,7 @@ _interpqueues_put(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyO
     } _kwtuple = {
         .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
         .ob_hash = -1,
-        .ob_item = { &_Py_ID(qid), &_Py_ID(obj), &_Py_ID(unboundop), &_Py_ID(fallback), },
+        .ob_item = { &_Py_ID(qid), &_Py_ID(obj), &_Py_ID(unboundop), &_Py_ID(fallback), &_Py_ID(blocking), &_Py_ID(timeout), },
     };
     #undef NUM_KEYWORDS
     #define KWTUPLE (&_kwtuple.ob_base.ob_base)
@@ -222,19 +227,21 @@ _interpqueues_put(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyO
     #  define KWTUPLE NULL
     #endif  // !Py_BUILD_CORE
 
-    static const char * const _keywords[] = {"qid", "obj", "unboundop", "fallback", NULL};
+    static const char * const _keywords[] = {"qid", "obj", "unboundop", "fallback", "blocking", "timeout", NULL};
     static _PyArg_Parser _parser = {
         .keywords = _keywords,
         .fname = "put",
         .kwtuple = KWTUPLE,
     };
     #undef KWTUPLE
-    PyObject *argsbuf[4];
+    PyObject *argsbuf[6];
     Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 2;
     int64_t qid;
     PyObject *obj;
     int unboundarg = -1;
     int fallbackarg = -1;
+    int blocking = 0;
+    PyObject *timeout_obj = Py_None;
 
     args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
             /*minpos*/ 2, /*maxpos*/ 4, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
@@ -257,30 +264,162 @@ _interpqueues_put(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyO
             goto skip_optional_pos;
         }
     }
-    fallbackarg = PyLong_AsInt(args[3]);
-    if (fallbackarg == -1 && PyErr_Occurred()) {
+    if (args[3]) {
+        fallbackarg = PyLong_AsInt(args[3]);
+        if (fallbackarg == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+skip_optional_pos:
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    if (args[4]) {
+        blocking = PyObject_IsTrue(args[4]);
+        if (blocking < 0) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    timeout_obj = args[5];
+skip_optional_kwonly:
+    return_value = _interpqueues_put_impl(module, qid, obj, unboundarg, fallbackarg, blocking, timeout_obj);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_interpqueues_put_many__doc__,
+"put_many($module, /, qid, objs, unboundop=-1, fallback=-1, *,\n"
+"         blocking=False, timeout=None)\n"
+"--\n"
+"\n"
+"Add the data of each object in the iterable to the queue, in order.\n"
+"\n"
+"This is like calling put() for each object, but the queue is locked once\n"
+"for all the objects that fit.  If the queue fills up, the objects that\n"
+"were added stay in the queue.");
+
+#define _INTERPQUEUES_PUT_MANY_METHODDEF    \
+    {"put_many", _PyCFunction_CAST(_interpqueues_put_many), METH_FASTCALL|METH_KEYWORDS, _interpqueues_put_many__doc__},
+
+static PyObject *
+_interpqueues_put_many_impl(PyObject *module, int64_t qid, PyObject *objs,
+                            int unboundarg, int fallbackarg, int blocking,
+                            PyObject *timeout_obj);
+
+static PyObject *
+_interpqueues_put_many(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 6
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(qid), &_Py_ID(objs), &_Py_ID(unboundop), &_Py_ID(fallback), &_Py_ID(blocking), &_Py_ID(timeout), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"qid", "objs", "unboundop", "fallback", "blocking", "timeout", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "put_many",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[6];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 2;
+    int64_t qid;
+    PyObject *objs;
+    int unboundarg = -1;
+    int fallbackarg = -1;
+    int blocking = 0;
+    PyObject *timeout_obj = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 4, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!qidarg_converter(args[0], &qid)) {
         goto exit;
     }
+    objs = args[1];
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (args[2]) {
+        unboundarg = PyLong_AsInt(args[2]);
+        if (unboundarg == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    if (args[3]) {
+        fallbackarg = PyLong_AsInt(args[3]);
+        if (fallbackarg == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
 skip_optional_pos:
-    return_value = _interpqueues_put_impl(module, qid, obj, unboundarg, fallbackarg);
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    if (args[4]) {
+        blocking = PyObject_IsTrue(args[4]);
+        if (blocking < 0) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    timeout_obj = args[5];
+skip_optional_kwonly:
+    return_value = _interpqueues_put_many_impl(module, qid, objs, unboundarg, fallbackarg, blocking, timeout_obj);
 
 exit:
     return return_value;
 }
 
 PyDoc_STRVAR(_interpqueues_get__doc__,
-"get($module, /, qid)\n"
+"get($module, /, qid, *, blocking=False, timeout=None)\n"
 "--\n"
 "\n"
 "Return the (object, unbound op) from the front of the queue.\n"
 "\n"
-"If there is nothing to receive then raise QueueEmpty.");
+"If there is nothing to receive then raise QueueEmpty, unless blocking\n"
+"is true.  In that case, wait for an item, for at most timeout seconds\n"
+"if it is not None.");
 
 #define _INTERPQUEUES_GET_METHODDEF    \
     {"get", _PyCFunction_CAST(_interpqueues_get), METH_FASTCALL|METH_KEYWORDS, _interpqueues_get__doc__},
 
 static PyObject *
-_interpqueues_get_impl(PyObject *module, int64_t qid);
+_interpqueues_get_impl(PyObject *module, int64_t qid, int blocking,
+                       PyObject *timeout_obj);
 
 static PyObject *
 _interpqueues_get(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
@@ -288,7 +427,7 @@ _interpqueues_get(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyO
     PyObject *return_value = NULL;
     #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
 
-    #define NUM_KEYWORDS 1
+    #define NUM_KEYWORDS 3
     static struct {
         PyGC_Head _this_is_not_used;
         PyObject_VAR_HEAD
@@ -297,7 +436,7 @@ _interpqueues_get(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyO
     } _kwtuple = {
         .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
         .ob_hash = -1,
-        .ob_item = { &_Py_ID(qid), },
+        .ob_item = { &_Py_ID(qid), &_Py_ID(blocking), &_Py_ID(timeout), },
     };
     #undef NUM_KEYWORDS
     #define KWTUPLE (&_kwtuple.ob_base.ob_base)
@@ -306,15 +445,18 @@ _interpqueues_get(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyO
     #  define KWTUPLE NULL
     #endif  // !Py_BUILD_CORE
 
-    static const char * const _keywords[] = {"qid", NULL};
+    static const char * const _keywords[] = {"qid", "blocking", "timeout", NULL};
     static _PyArg_Parser _parser = {
         .keywords = _keywords,
         .fname = "get",
         .kwtuple = KWTUPLE,
     };
     #undef KWTUPLE
-    PyObject *argsbuf[1];
+    PyObject *argsbuf[3];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 1;
     int64_t qid;
+    int blocking = 0;
+    PyObject *timeout_obj = Py_None;
 
     args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
             /*minpos*/ 1, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
@@ -324,7 +466,116 @@ _interpqueues_get(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyO
     if (!qidarg_converter(args[0], &qid)) {
         goto exit;
     }
-    return_value = _interpqueues_get_impl(module, qid);
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    if (args[1]) {
+        blocking = PyObject_IsTrue(args[1]);
+        if (blocking < 0) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    timeout_obj = args[2];
+skip_optional_kwonly:
+    return_value = _interpqueues_get_impl(module, qid, blocking, timeout_obj);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_interpqueues_get_many__doc__,
+"get_many($module, /, qid, maxitems, *, blocking=False, timeout=None)\n"
+"--\n"
+"\n"
+"Return a list of up to maxitems (object, unbound op) from the queue.\n"
+"\n"
+"The list is never empty: it is like get() for the first item, and then\n"
+"takes the items available right away, without waiting.");
+
+#define _INTERPQUEUES_GET_MANY_METHODDEF    \
+    {"get_many", _PyCFunction_CAST(_interpqueues_get_many), METH_FASTCALL|METH_KEYWORDS, _interpqueues_get_many__doc__},
+
+static PyObject *
+_interpqueues_get_many_impl(PyObject *module, int64_t qid,
+                            Py_ssize_t maxitems, int blocking,
+                            PyObject *timeout_obj);
+
+static PyObject *
+_interpqueues_get_many(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 4
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(qid), &_Py_ID(maxitems), &_Py_ID(blocking), &_Py_ID(timeout), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"qid", "maxitems", "blocking", "timeout", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "get_many",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[4];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 2;
+    int64_t qid;
+    Py_ssize_t maxitems;
+    int blocking = 0;
+    PyObject *timeout_obj = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!qidarg_converter(args[0], &qid)) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        maxitems = ival;
+    }
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    if (args[2]) {
+        blocking = PyObject_IsTrue(args[2]);
+        if (blocking < 0) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    timeout_obj = args[3];
+skip_optional_kwonly:
+    return_value = _interpqueues_get_many_impl(module, qid, maxitems, blocking, timeout_obj);
 
 exit:
     return return_value;
@@ -762,4 +1013,4 @@ _interpqueues__register_heap_types(PyObject *module, PyObject *const *args, Py_s
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=64cea8e1063429b6 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=168433ae61e2b2d8 input=a9049054013a1b77]*/
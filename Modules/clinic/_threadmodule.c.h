@@ -637,6 +637,358 @@ _thread_RLock__at_fork_reinit(PyObject *self, PyObject *Py_UNUSED(ignored))
 
 #endif /* defined(HAVE_FORK) */
 
+PyDoc_STRVAR(atomic_int_new__doc__,
+"AtomicInt(value=0)\n"
+"--\n"
+"\n"
+"A 64-bit integer that can be updated atomically from several threads.\n"
+"\n"
+"Arithmetic wraps around on overflow, as for a C int64_t.");
+
+static PyObject *
+atomic_int_new_impl(PyTypeObject *type, PyObject *value);
+
+static PyObject *
+atomic_int_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(value), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"value", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "AtomicInt",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 0;
+    PyObject *value = NULL;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser,
+            /*minpos*/ 0, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    value = fastargs[0];
+skip_optional_pos:
+    return_value = atomic_int_new_impl(type, value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_thread_AtomicInt_load__doc__,
+"load($self, /)\n"
+"--\n"
+"\n"
+"Return the current value.");
+
+#define _THREAD_ATOMICINT_LOAD_METHODDEF    \
+    {"load", (PyCFunction)_thread_AtomicInt_load, METH_NOARGS, _thread_AtomicInt_load__doc__},
+
+static PyObject *
+_thread_AtomicInt_load_impl(atomicintobject *self);
+
+static PyObject *
+_thread_AtomicInt_load(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _thread_AtomicInt_load_impl((atomicintobject *)self);
+}
+
+PyDoc_STRVAR(_thread_AtomicInt_store__doc__,
+"store($self, value, /)\n"
+"--\n"
+"\n"
+"Set the value.");
+
+#define _THREAD_ATOMICINT_STORE_METHODDEF    \
+    {"store", (PyCFunction)_thread_AtomicInt_store, METH_O, _thread_AtomicInt_store__doc__},
+
+static PyObject *
+_thread_AtomicInt_store_impl(atomicintobject *self, PyObject *value);
+
+static PyObject *
+_thread_AtomicInt_store(PyObject *self, PyObject *value)
+{
+    PyObject *return_value = NULL;
+
+    return_value = _thread_AtomicInt_store_impl((atomicintobject *)self, value);
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_thread_AtomicInt_exchange__doc__,
+"exchange($self, value, /)\n"
+"--\n"
+"\n"
+"Set the value and return the previous value.");
+
+#define _THREAD_ATOMICINT_EXCHANGE_METHODDEF    \
+    {"exchange", (PyCFunction)_thread_AtomicInt_exchange, METH_O, _thread_AtomicInt_exchange__doc__},
+
+static PyObject *
+_thread_AtomicInt_exchange_impl(atomicintobject *self, PyObject *value);
+
+static PyObject *
+_thread_AtomicInt_exchange(PyObject *self, PyObject *value)
+{
+    PyObject *return_value = NULL;
+
+    return_value = _thread_AtomicInt_exchange_impl((atomicintobject *)self, value);
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_thread_AtomicInt_add__doc__,
+"add($self, delta=1, /)\n"
+"--\n"
+"\n"
+"Add delta to the value and return the previous value.");
+
+#define _THREAD_ATOMICINT_ADD_METHODDEF    \
+    {"add", _PyCFunction_CAST(_thread_AtomicInt_add), METH_FASTCALL, _thread_AtomicInt_add__doc__},
+
+static PyObject *
+_thread_AtomicInt_add_impl(atomicintobject *self, PyObject *delta);
+
+static PyObject *
+_thread_AtomicInt_add(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *delta = NULL;
+
+    if (!_PyArg_CheckPositional("add", nargs, 0, 1)) {
+        goto exit;
+    }
+    if (nargs < 1) {
+        goto skip_optional;
+    }
+    delta = args[0];
+skip_optional:
+    return_value = _thread_AtomicInt_add_impl((atomicintobject *)self, delta);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_thread_AtomicInt_compare_exchange__doc__,
+"compare_exchange($self, expected, desired, /)\n"
+"--\n"
+"\n"
+"Set the value to desired if it is equal to expected.\n"
+"\n"
+"Return True if the value was replaced, False otherwise.");
+
+#define _THREAD_ATOMICINT_COMPARE_EXCHANGE_METHODDEF    \
+    {"compare_exchange", _PyCFunction_CAST(_thread_AtomicInt_compare_exchange), METH_FASTCALL, _thread_AtomicInt_compare_exchange__doc__},
+
+static PyObject *
+_thread_AtomicInt_compare_exchange_impl(atomicintobject *self,
+                                        PyObject *expected,
+                                        PyObject *desired);
+
+static PyObject *
+_thread_AtomicInt_compare_exchange(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *expected;
+    PyObject *desired;
+
+    if (!_PyArg_CheckPositional("compare_exchange", nargs, 2, 2)) {
+        goto exit;
+    }
+    expected = args[0];
+    desired = args[1];
+    return_value = _thread_AtomicInt_compare_exchange_impl((atomicintobject *)self, expected, desired);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(atomic_ref_new__doc__,
+"AtomicRef(value=None)\n"
+"--\n"
+"\n"
+"An object reference that can be replaced atomically from several threads.\n"
+"\n"
+"compare_exchange() compares objects by identity.");
+
+static PyObject *
+atomic_ref_new_impl(PyTypeObject *type, PyObject *value);
+
+static PyObject *
+atomic_ref_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(value), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"value", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "AtomicRef",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 0;
+    PyObject *value = Py_None;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser,
+            /*minpos*/ 0, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    value = fastargs[0];
+skip_optional_pos:
+    return_value = atomic_ref_new_impl(type, value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_thread_AtomicRef_load__doc__,
+"load($self, /)\n"
+"--\n"
+"\n"
+"Return the current object.");
+
+#define _THREAD_ATOMICREF_LOAD_METHODDEF    \
+    {"load", (PyCFunction)_thread_AtomicRef_load, METH_NOARGS, _thread_AtomicRef_load__doc__},
+
+static PyObject *
+_thread_AtomicRef_load_impl(atomicrefobject *self);
+
+static PyObject *
+_thread_AtomicRef_load(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _thread_AtomicRef_load_impl((atomicrefobject *)self);
+}
+
+PyDoc_STRVAR(_thread_AtomicRef_store__doc__,
+"store($self, value, /)\n"
+"--\n"
+"\n"
+"Replace the current object.");
+
+#define _THREAD_ATOMICREF_STORE_METHODDEF    \
+    {"store", (PyCFunction)_thread_AtomicRef_store, METH_O, _thread_AtomicRef_store__doc__},
+
+static PyObject *
+_thread_AtomicRef_store_impl(atomicrefobject *self, PyObject *value);
+
+static PyObject *
+_thread_AtomicRef_store(PyObject *self, PyObject *value)
+{
+    PyObject *return_value = NULL;
+
+    return_value = _thread_AtomicRef_store_impl((atomicrefobject *)self, value);
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_thread_AtomicRef_exchange__doc__,
+"exchange($self, value, /)\n"
+"--\n"
+"\n"
+"Replace the current object and return the previous one.");
+
+#define _THREAD_ATOMICREF_EXCHANGE_METHODDEF    \
+    {"exchange", (PyCFunction)_thread_AtomicRef_exchange, METH_O, _thread_AtomicRef_exchange__doc__},
+
+static PyObject *
+_thread_AtomicRef_exchange_impl(atomicrefobject *self, PyObject *value);
+
+static PyObject *
+_thread_AtomicRef_exchange(PyObject *self, PyObject *value)
+{
+    PyObject *return_value = NULL;
+
+    return_value = _thread_AtomicRef_exchange_impl((atomicrefobject *)self, value);
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_thread_AtomicRef_compare_exchange__doc__,
+"compare_exchange($self, expected, desired, /)\n"
+"--\n"
+"\n"
+"Replace the current object with desired if it is expected.\n"
+"\n"
+"Return True if the object was replaced, False otherwise.");
+
+#define _THREAD_ATOMICREF_COMPARE_EXCHANGE_METHODDEF    \
+    {"compare_exchange", _PyCFunction_CAST(_thread_AtomicRef_compare_exchange), METH_FASTCALL, _thread_AtomicRef_compare_exchange__doc__},
+
+static PyObject *
+_thread_AtomicRef_compare_exchange_impl(atomicrefobject *self,
+                                        PyObject *expected,
+                                        PyObject *desired);
+
+static PyObject *
+_thread_AtomicRef_compare_exchange(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *expected;
+    PyObject *desired;
+
+    if (!_PyArg_CheckPositional("compare_exchange", nargs, 2, 2)) {
+        goto exit;
+    }
+    expected = args[0];
+    desired = args[1];
+    return_value = _thread_AtomicRef_compare_exchange_impl((atomicrefobject *)self, expected, desired);
+
+exit:
+    return return_value;
+}
+
 #if (defined(HAVE_PTHREAD_GETNAME_NP) || defined(HAVE_PTHREAD_GET_NAME_NP) || defined(MS_WINDOWS))
 
 PyDoc_STRVAR(_thread__get_name__doc__,
@@ -740,4 +1092,4 @@ exit:
 #ifndef _THREAD_SET_NAME_METHODDEF
     #define _THREAD_SET_NAME_METHODDEF
 #endif /* !defined(_THREAD_SET_NAME_METHODDEF) */
-/*[clinic end generated code: output=1255a1520f43f97a input=a9049054013a1b77]*/
+/*[clinic end generated code: output=a88cf763cb955b97 input=a9049054013a1b77]*/
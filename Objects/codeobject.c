@@ -345,6 +345,15 @@ validate_and_copy_tuple(PyObject *tup)
     return newtuple;
 }
 
+/* The caches pointed to by _co_cached, followed by the ones that are only
+   used by the interpreter. */
+typedef struct {
+    _PyCoCached base;
+    PyObject *match_tables;
+} code_cached;
+
+#define CODE_CACHED(co) ((code_cached *)(co)->_co_cached)
+
 static int
 init_co_cached(PyCodeObject *self)
 {
@@ -356,15 +365,17 @@ init_co_cached(PyCodeObject *self)
     Py_BEGIN_CRITICAL_SECTION(self);
     cached = self->_co_cached;
     if (cached == NULL) {
-        cached = PyMem_New(_PyCoCached, 1);
-        if (cached == NULL) {
+        code_cached *full = PyMem_New(code_cached, 1);
+        if (full == NULL) {
             PyErr_NoMemory();
         }
         else {
+            cached = &full->base;
             cached->_co_code = NULL;
             cached->_co_cellvars = NULL;
             cached->_co_freevars = NULL;
             cached->_co_varnames = NULL;
+            full->match_tables = NULL;
             FT_ATOMIC_STORE_PTR(self->_co_cached, cached);
         }
     }
@@ -2254,6 +2265,61 @@ PyCode_GetCode(PyCodeObject *co)
     return _PyCode_GetCode(co);
 }
 
+/* Return the dict mapping each value to its case index for the dispatch
+   table of a match statement.  cases is the tuple of (value, index) pairs
+   emitted by the compiler, in the order of the patterns.  The dict is built
+   on first use and cached on the code object. */
+PyObject *
+_PyCode_GetMatchTable(PyCodeObject *co, PyObject *cases)
+{
+    assert(PyTuple_CheckExact(cases));
+    if (init_co_cached(co)) {
+        return NULL;
+    }
+
+    code_cached *cached = CODE_CACHED(co);
+    PyObject *tables = FT_ATOMIC_LOAD_PTR_ACQUIRE(cached->match_tables);
+    if (tables == NULL) {
+        Py_BEGIN_CRITICAL_SECTION(co);
+        tables = cached->match_tables;
+        if (tables == NULL) {
+            tables = PyDict_New();
+            if (tables != NULL) {
+                FT_ATOMIC_STORE_PTR_RELEASE(cached->match_tables, tables);
+            }
+        }
+        Py_END_CRITICAL_SECTION();
+        if (tables == NULL) {
+            return NULL;
+        }
+    }
+
+    PyObject *table;
+    int res = PyDict_GetItemRef(tables, cases, &table);
+    if (res != 0) {
+        return table;
+    }
+    table = PyDict_New();
+    if (table == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(cases); i++) {
+        PyObject *pair = PyTuple_GET_ITEM(cases, i);
+        assert(PyTuple_CheckExact(pair) && PyTuple_GET_SIZE(pair) == 2);
+        // The first pattern matching a value wins.
+        if (PyDict_SetDefaultRef(table, PyTuple_GET_ITEM(pair, 0),
+                                 PyTuple_GET_ITEM(pair, 1), NULL) < 0)
+        {
+            Py_DECREF(table);
+            return NULL;
+        }
+    }
+    PyObject *result;
+    res = PyDict_SetDefaultRef(tables, cases, table, &result);
+    Py_DECREF(table);
+    return res < 0 ? NULL : result;
+}
+
 /******************
  * PyCode_Type
  ******************/
@@ -2455,6 +2521,7 @@ code_dealloc(PyObject *self)
         Py_XDECREF(co->_co_cached->_co_cellvars);
         Py_XDECREF(co->_co_cached->_co_freevars);
         Py_XDECREF(co->_co_cached->_co_varnames);
+        Py_XDECREF(CODE_CACHED(co)->match_tables);
         PyMem_Free(co->_co_cached);
     }
     FT_CLEAR_WEAKREFS(self, co->co_weakreflist);
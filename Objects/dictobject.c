@@ -47,6 +47,12 @@ PyDictUnicodeEntry otherwise. Its length is USABLE_FRACTION(dk_size).
 NOTE: Since negative value is used for DKIX_EMPTY and DKIX_DUMMY, type of
 dk_indices entry is signed integer and int16 is used for table which
 dk_size == 256.
+
+An index into dk_entries is always smaller than dk_size, so int32 and int64
+indices have unused high bits.  Up to 8 of them, just above DK_MASK(dk),
+store the same bits of the hash of the entry (see dictkeys_tag_mask()).
+Probing a large table can then skip most entries with a different hash
+without reading them, which saves a cache miss for each collision.
 */
 
 
@@ -127,6 +133,7 @@ As a consequence of this, split keys have a maximum size of 16.
 #include "pycore_object.h"        // _PyObject_GC_TRACK(), _PyDebugAllocatorStats()
 #include "pycore_pyatomic_ft_wrappers.h" // FT_ATOMIC_LOAD_SSIZE_RELAXED
 #include "pycore_pyerrors.h"      // _PyErr_GetRaisedException()
+#include "pycore_pymem.h"         // PREFETCH_T0()
 #include "pycore_pystate.h"       // _PyThreadState_GET()
 #include "pycore_setobject.h"     // _PySet_NextEntry()
 #include "pycore_tuple.h"         // _PyTuple_Recycle()
@@ -473,9 +480,24 @@ dictkeys_decref(PyDictKeysObject *dk, bool use_qsbr)
     }
 }
 
-/* lookup indices.  returns DKIX_EMPTY, DKIX_DUMMY, or ix >=0 */
+/* Mask of the bits of the indices which hold bits of the hash of the
+   entries.  It is 0 for tables with int8 and int16 indices. */
+static inline size_t
+dictkeys_tag_mask(const PyDictKeysObject *keys)
+{
+    int log2size = DK_LOG_SIZE(keys);
+    if (log2size < 16) {
+        return 0;
+    }
+    int index_bits = log2size < 32 ? 31 : 63;
+    int tag_bits = Py_MIN(8, index_bits - log2size);
+    return (((size_t)1 << tag_bits) - 1) << log2size;
+}
+
+/* lookup indices, including the bits of the hash for ix >= 0.
+   returns DKIX_EMPTY, DKIX_DUMMY, or ix >=0 */
 static inline Py_ssize_t
-dictkeys_get_index(const PyDictKeysObject *keys, Py_ssize_t i)
+dictkeys_get_tagged_index(const PyDictKeysObject *keys, Py_ssize_t i)
 {
     int log2size = DK_LOG_SIZE(keys);
     Py_ssize_t ix;
@@ -498,6 +520,17 @@ dictkeys_get_index(const PyDictKeysObject *keys, Py_ssize_t i)
     return ix;
 }
 
+/* lookup indices.  returns DKIX_EMPTY, DKIX_DUMMY, or ix >=0 */
+static inline Py_ssize_t
+dictkeys_get_index(const PyDictKeysObject *keys, Py_ssize_t i)
+{
+    Py_ssize_t ix = dictkeys_get_tagged_index(keys, i);
+    if (ix >= 0) {
+        ix &= DK_MASK(keys);
+    }
+    return ix;
+}
+
 /* write to indices. */
 static inline void
 dictkeys_set_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix)
@@ -526,6 +559,16 @@ dictkeys_set_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix)
     }
 }
 
+/* write the index of an entry with the given hash to indices. */
+static inline void
+dictkeys_set_entry_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix,
+                         Py_hash_t hash)
+{
+    assert(ix >= 0 && (size_t)ix <= (size_t)DK_MASK(keys));
+    size_t tag = (size_t)hash & dictkeys_tag_mask(keys);
+    dictkeys_set_index(keys, i, ix | (Py_ssize_t)tag);
+}
+
 
 /* USABLE_FRACTION is the maximum dictionary load.
  * Increasing this ratio makes dictionaries more dense resulting in more
@@ -1000,12 +1043,15 @@ do_lookup(PyDictObject *mp, PyDictKeysObject *dk, PyObject *key, Py_hash_t hash,
 {
     void *ep0 = _DK_ENTRIES(dk);
     size_t mask = DK_MASK(dk);
+    size_t tag_mask = dictkeys_tag_mask(dk);
+    size_t tag = (size_t)hash & tag_mask;
     size_t perturb = hash;
     size_t i = (size_t)hash & mask;
     Py_ssize_t ix;
     for (;;) {
-        ix = dictkeys_get_index(dk, i);
-        if (ix >= 0) {
+        ix = dictkeys_get_tagged_index(dk, i);
+        if (ix >= 0 && ((size_t)ix & tag_mask) == tag) {
+            ix &= mask;
             int cmp = check_lookup(mp, dk, ep0, ix, key, hash);
             if (cmp < 0) {
                 return cmp;
@@ -1020,8 +1066,9 @@ do_lookup(PyDictObject *mp, PyDictKeysObject *dk, PyObject *key, Py_hash_t hash,
         i = mask & (i*5 + perturb + 1);
 
         // Manual loop unrolling
-        ix = dictkeys_get_index(dk, i);
-        if (ix >= 0) {
+        ix = dictkeys_get_tagged_index(dk, i);
+        if (ix >= 0 && ((size_t)ix & tag_mask) == tag) {
+            ix &= mask;
             int cmp = check_lookup(mp, dk, ep0, ix, key, hash);
             if (cmp < 0) {
                 return cmp;
@@ -1770,6 +1817,45 @@ insertion_resize(PyDictObject *mp, int unicode)
     return dictresize(mp, calculate_log2_keysize(GROWTH_RATE(mp)), unicode);
 }
 
+/* Bulk insertions from a list or tuple prefetch the index slot of the key
+   this many items ahead. */
+#define DICT_PREFETCH_DISTANCE 8
+
+static inline void
+dict_prefetch_key(PyDictObject *mp, PyObject *key)
+{
+    Py_hash_t hash = _PyObject_PeekHash(key);
+    if (hash != -1) {
+        PyDictKeysObject *keys = mp->ma_keys;
+        size_t i = (size_t)hash & DK_MASK(keys);
+        int shift = keys->dk_log2_index_bytes - DK_LOG_SIZE(keys);
+        PREFETCH_T0(&keys->dk_indices[i << shift]);
+    }
+}
+
+/* Grow a full table ahead of a bulk insertion, see _PyDict_EstimateBulkSize().
+   Called before each item; does nothing while the next new key fits or if
+   the estimate is not above the size insertion_resize() would pick. */
+static int
+dict_bulk_reserve(PyDictObject *mp, Py_ssize_t seen, Py_ssize_t added,
+                  Py_ssize_t remaining)
+{
+    ASSERT_DICT_LOCKED(mp);
+    if (mp->ma_keys->dk_usable > 0 || _PyDict_HasSplitTable(mp)) {
+        return 0;
+    }
+    Py_ssize_t expected = _PyDict_EstimateBulkSize(mp->ma_used, seen, added,
+                                                   remaining);
+    if (expected == 0) {
+        return 0;
+    }
+    uint8_t log2_newsize = estimate_log2_keysize(expected);
+    if (log2_newsize <= calculate_log2_keysize(GROWTH_RATE(mp))) {
+        return 0;
+    }
+    return dictresize(mp, log2_newsize, 1);
+}
+
 static inline int
 insert_combined_dict(PyInterpreterState *interp, PyDictObject *mp,
                      Py_hash_t hash, PyObject *key, PyObject *value)
@@ -1793,7 +1879,7 @@ insert_combined_dict(PyInterpreterState *interp, PyDictObject *mp,
     FT_ATOMIC_STORE_UINT32_RELAXED(mp->ma_keys->dk_version, 0);
 
     Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
-    dictkeys_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
+    dictkeys_set_entry_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries, hash);
 
     if (DK_IS_UNICODE(mp->ma_keys)) {
         PyDictUnicodeEntry *ep;
@@ -1835,7 +1921,7 @@ insert_split_key(PyDictKeysObject *keys, PyObject *key, Py_hash_t hash)
         FT_ATOMIC_STORE_UINT32_RELAXED(keys->dk_version, 0);
         Py_ssize_t hashpos = find_empty_slot(keys, hash);
         ix = keys->dk_nentries;
-        dictkeys_set_index(keys, hashpos, ix);
+        dictkeys_set_entry_index(keys, hashpos, ix, hash);
         PyDictUnicodeEntry *ep = &DK_UNICODE_ENTRIES(keys)[ix];
         STORE_SHARED_KEY(ep->me_key, Py_NewRef(key));
         split_keys_entry_added(keys);
@@ -1961,7 +2047,7 @@ insert_to_emptydict(PyInterpreterState *interp, PyDictObject *mp,
     assert(mp->ma_values == NULL);
 
     size_t hashpos = (size_t)hash & (PyDict_MINSIZE-1);
-    dictkeys_set_index(newkeys, hashpos, 0);
+    dictkeys_set_entry_index(newkeys, hashpos, 0, hash);
     if (unicode) {
         PyDictUnicodeEntry *ep = DK_UNICODE_ENTRIES(newkeys);
         ep->me_key = key;
@@ -1999,7 +2085,7 @@ build_indices_generic(PyDictKeysObject *keys, PyDictKeyEntry *ep, Py_ssize_t n)
             perturb >>= PERTURB_SHIFT;
             i = mask & (i*5 + perturb + 1);
         }
-        dictkeys_set_index(keys, i, ix);
+        dictkeys_set_entry_index(keys, i, ix, hash);
     }
 }
 
@@ -2015,7 +2101,7 @@ build_indices_unicode(PyDictKeysObject *keys, PyDictUnicodeEntry *ep, Py_ssize_t
             perturb >>= PERTURB_SHIFT;
             i = mask & (i*5 + perturb + 1);
         }
-        dictkeys_set_index(keys, i, ix);
+        dictkeys_set_entry_index(keys, i, ix, hash);
     }
 }
 
@@ -3283,9 +3369,36 @@ _PyDict_FromKeys(PyObject *cls, PyObject *iterable, PyObject *value)
     }
 
     if (PyDict_CheckExact(d)) {
+        PyDictObject *mp = (PyDictObject *)d;
+        /* Guess the number of items. */
+        Py_ssize_t hint = PyObject_LengthHint(iterable, 0);
+        if (hint < 0) {
+            goto Fail;
+        }
+        /* See merge_from_seq2_lock_held() for why lists are excluded. */
+        int sequence = PyTuple_CheckExact(iterable);
+#ifndef Py_GIL_DISABLED
+        sequence = sequence || PyList_CheckExact(iterable);
+#endif
+        Py_ssize_t seen = 0;
         Py_BEGIN_CRITICAL_SECTION(d);
+        Py_ssize_t start = mp->ma_used;
         while ((key = PyIter_Next(it)) != NULL) {
-            status = setitem_lock_held((PyDictObject *)d, key, value);
+            if (seen < hint
+                && dict_bulk_reserve(mp, seen, mp->ma_used - start,
+                                     hint - seen) < 0)
+            {
+                Py_DECREF(key);
+                goto dict_iter_exit;
+            }
+            if (sequence && seen + DICT_PREFETCH_DISTANCE
+                            < PySequence_Fast_GET_SIZE(iterable))
+            {
+                dict_prefetch_key(mp, PySequence_Fast_GET_ITEM(
+                    iterable, seen + DICT_PREFETCH_DISTANCE));
+            }
+            seen++;
+            status = setitem_lock_held(mp, key, value);
             Py_DECREF(key);
             if (status < 0) {
                 assert(PyErr_Occurred());
@@ -3762,6 +3875,20 @@ merge_from_seq2_lock_held(PyObject *d, PyObject *seq2, int override)
     if (it == NULL)
         return -1;
 
+    /* Guess the number of items. */
+    Py_ssize_t hint = PyObject_LengthHint(seq2, 0);
+    if (hint < 0) {
+        Py_DECREF(it);
+        return -1;
+    }
+    int sequence = PyTuple_CheckExact(seq2);
+#ifndef Py_GIL_DISABLED
+    /* In the free-threaded build, the items of a list can only be read
+       safely through its iterator. */
+    sequence = sequence || PyList_CheckExact(seq2);
+#endif
+    Py_ssize_t start = ((PyDictObject *)d)->ma_used;
+
     for (i = 0; ; ++i) {
         PyObject *key, *value;
         Py_ssize_t n;
@@ -3774,6 +3901,24 @@ merge_from_seq2_lock_held(PyObject *d, PyObject *seq2, int override)
             break;
         }
 
+        if (i < hint
+            && dict_bulk_reserve((PyDictObject *)d, i,
+                                 ((PyDictObject *)d)->ma_used - start,
+                                 hint - i) < 0)
+        {
+            goto Fail;
+        }
+        if (sequence
+            && i + DICT_PREFETCH_DISTANCE < PySequence_Fast_GET_SIZE(seq2))
+        {
+            PyObject *next = PySequence_Fast_GET_ITEM(
+                seq2, i + DICT_PREFETCH_DISTANCE);
+            if (PyTuple_CheckExact(next) && PyTuple_GET_SIZE(next) == 2) {
+                dict_prefetch_key((PyDictObject *)d,
+                                  PyTuple_GET_ITEM(next, 0));
+            }
+        }
+
         /* Convert item to sequence, and verify length 2. */
         fast = PySequence_Fast(item, "object is not iterable");
         if (fast == NULL) {
@@ -3986,6 +4131,8 @@ dict_merge(PyInterpreterState *interp, PyObject *a, PyObject *b, int override)
             goto slow_exit;
         }
 
+        assert(PyList_Check(keys));
+        Py_ssize_t nkeys = PyList_GET_SIZE(keys);
         iter = PyObject_GetIter(keys);
         Py_DECREF(keys);
         if (iter == NULL) {
@@ -3993,7 +4140,19 @@ dict_merge(PyInterpreterState *interp, PyObject *a, PyObject *b, int override)
             goto slow_exit;
         }
 
+        Py_ssize_t seen = 0;
+        Py_ssize_t start = mp->ma_used;
         for (key = PyIter_Next(iter); key; key = PyIter_Next(iter)) {
+            if (seen < nkeys
+                && dict_bulk_reserve(mp, seen, mp->ma_used - start,
+                                     nkeys - seen) < 0)
+            {
+                Py_DECREF(key);
+                Py_DECREF(iter);
+                res = -1;
+                goto slow_exit;
+            }
+            seen++;
             if (override != 1) {
                 status = PyDict_Contains(a, key);
                 if (status != 0) {
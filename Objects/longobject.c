@@ -31,14 +31,21 @@ class int "PyObject *" "&PyLong_Type"
 #define _MAX_STR_DIGITS_ERROR_FMT_TO_INT "Exceeds the limit (%d digits) for integer string conversion: value has %zd digits; use sys.set_int_max_str_digits() to increase the limit"
 #define _MAX_STR_DIGITS_ERROR_FMT_TO_STR "Exceeds the limit (%d digits) for integer string conversion; use sys.set_int_max_str_digits() to increase the limit"
 
-/* If defined, use algorithms from the _pylong.py module */
-#define WITH_PYLONG_MODULE 1
-
 // Forward declarations
 static PyLongObject* long_neg(PyLongObject *v);
 static PyLongObject *x_divrem(PyLongObject *, PyLongObject *, PyLongObject **);
+static PyLongObject *x_divrem_bz(PyLongObject *, PyLongObject *,
+                                 PyLongObject **);
 static PyObject* long_long(PyObject *v);
 static PyObject* long_lshift_int64(PyLongObject *a, int64_t shiftby);
+static PyLongObject *long_add(PyLongObject *a, PyLongObject *b);
+static PyLongObject *long_mul(PyLongObject *a, PyLongObject *b);
+static int long_divrem(PyLongObject *, PyLongObject *,
+                       PyLongObject **, PyLongObject **);
+static PyObject *long_lshift1(PyLongObject *a, Py_ssize_t wordshift,
+                              digit remshift);
+static PyObject *long_rshift1(PyLongObject *a, Py_ssize_t wordshift,
+                              digit remshift);
 
 
 static inline void
@@ -83,6 +90,31 @@ maybe_small_long(PyLongObject *v)
 #define KARATSUBA_CUTOFF 70
 #define KARATSUBA_SQUARE_CUTOFF (2 * KARATSUBA_CUTOFF)
 
+/* Above TOOM3_CUTOFF digits, k_mul() switches from Karatsuba to Toom-Cook
+ * 3-way multiplication.
+ */
+#define TOOM3_CUTOFF 300
+
+/* Above NTT_CUTOFF digits, it switches to multiplication by number-theoretic
+ * transforms.
+ */
+#define NTT_CUTOFF 12000
+
+/* Division switches from the schoolbook x_divrem() to the recursive
+ * x_divrem_bz() when both the divisor and the quotient have more than
+ * BZ_CUTOFF digits.
+ */
+#define BZ_CUTOFF 100
+#define USE_BZ_DIVISION(size_a, size_b) \
+    ((size_b) > BZ_CUTOFF && (size_a) - (size_b) > BZ_CUTOFF)
+
+/* Conversions between ints and strings in non-binary bases split the number
+ * in halves, recursively, above STR_DC_CUTOFF digits (for int to decimal
+ * string) or FROM_STR_DC_CUTOFF characters (for string to int).
+ */
+#define STR_DC_CUTOFF 500
+#define FROM_STR_DC_CUTOFF 2000
+
 /* For exponentiation, use the binary left-to-right algorithm unless the
  ^ exponent contains more than HUGE_EXP_CUTOFF bits.  In that case, do
  * (no more than) EXP_WINDOW_SIZE bits at a time.  The potential drawback is
@@ -2014,72 +2046,135 @@ rem1(PyLongObject *a, digit n)
     );
 }
 
-#ifdef WITH_PYLONG_MODULE
-/* asymptotically faster long_to_decimal_string, using _pylong.py */
-static int
-pylong_int_to_decimal_string(PyObject *aa,
-                             PyObject **p_output,
-                             _PyUnicodeWriter *writer,
-                             PyBytesWriter *bytes_writer,
-                             char **bytes_str)
-{
-    PyObject *s = NULL;
-    PyObject *mod = PyImport_ImportModule("_pylong");
-    if (mod == NULL) {
-        return -1;
+/* Powers of a small base, computed on demand and kept for the duration of
+   one divide-and-conquer conversion between an int and a string.  Those
+   split numbers in halves, so the exponents needed at each level of the
+   recursion are the floor and the ceiling of the same fraction of the
+   original size, and computing a power by squaring the one of half the
+   exponent stays within that set.  Two entries per bit of a Py_ssize_t are
+   thus always enough.
+*/
+#define POW_CACHE_SIZE (2 * 8 * SIZEOF_SIZE_T)
+
+typedef struct {
+    digit base;
+    int len;
+    Py_ssize_t exp[POW_CACHE_SIZE];
+    PyLongObject *value[POW_CACHE_SIZE];
+} pow_cache;
+
+static void
+pow_cache_clear(pow_cache *cache)
+{
+    for (int i = 0; i < cache->len; i++) {
+        Py_DECREF(cache->value[i]);
     }
-    s = PyObject_CallMethod(mod, "int_to_decimal_string", "O", aa);
-    if (s == NULL) {
-        goto error;
+    cache->len = 0;
+}
+
+/* Return a borrowed reference to cache->base ** e, or NULL on failure. */
+static PyLongObject *
+pow_cache_get(pow_cache *cache, Py_ssize_t e)
+{
+    PyLongObject *half, *z;
+
+    assert(e > 0);
+    for (int i = 0; i < cache->len; i++) {
+        if (cache->exp[i] == e) {
+            return cache->value[i];
+        }
     }
-    if (!PyUnicode_Check(s)) {
-        PyErr_SetString(PyExc_TypeError,
-                        "_pylong.int_to_decimal_string did not return a str");
-        goto error;
+    if (e == 1) {
+        z = (PyLongObject *)PyLong_FromUnsignedLong(cache->base);
     }
-    if (writer) {
-        Py_ssize_t size = PyUnicode_GET_LENGTH(s);
-        if (_PyUnicodeWriter_Prepare(writer, size, '9') == -1) {
-            goto error;
-        }
-        if (_PyUnicodeWriter_WriteStr(writer, s) < 0) {
-            goto error;
+    else {
+        half = pow_cache_get(cache, e >> 1);
+        if (half == NULL)
+            return NULL;
+        z = long_mul(half, half);
+        if (z != NULL && (e & 1)) {
+            PyLongObject *base = pow_cache_get(cache, 1);
+            if (base == NULL) {
+                Py_DECREF(z);
+                return NULL;
+            }
+            Py_SETREF(z, long_mul(z, base));
         }
-        goto success;
     }
-    else if (bytes_writer) {
-        Py_ssize_t size = PyUnicode_GET_LENGTH(s);
-        const void *data = PyUnicode_DATA(s);
-        int kind = PyUnicode_KIND(s);
-        *bytes_str = PyBytesWriter_GrowAndUpdatePointer(bytes_writer, size,
-                                                        *bytes_str);
-        if (*bytes_str == NULL) {
-            goto error;
+    if (z == NULL)
+        return NULL;
+    assert(cache->len < POW_CACHE_SIZE);
+    cache->exp[cache->len] = e;
+    cache->value[cache->len] = z;
+    cache->len++;
+    return z;
+}
+
+/* Convert the digits of abs(a) to base _PyLong_DECIMAL_BASE in pout[0:size],
+   following Knuth (TAOCP, Volume 2 (3rd edn), section 4.4, Method 1b).
+   Return size, or -1 on failure.  pout must have room for the upper bound
+   computed in long_to_decimal_string_internal(). */
+static Py_ssize_t
+decimal_digits_schoolbook(PyLongObject *a, digit *pout)
+{
+    Py_ssize_t size = 0, size_a = _PyLong_DigitCount(a), i, j;
+    digit *pin = a->long_value.ob_digit;
+
+    for (i = size_a; --i >= 0; ) {
+        digit hi = pin[i];
+        for (j = 0; j < size; j++) {
+            twodigits z = (twodigits)pout[j] << PyLong_SHIFT | hi;
+            hi = (digit)(z / _PyLong_DECIMAL_BASE);
+            pout[j] = (digit)(z - (twodigits)hi *
+                              _PyLong_DECIMAL_BASE);
         }
-        char *p = *bytes_str;
-        for (Py_ssize_t i=0; i < size; i++) {
-            Py_UCS4 ch = PyUnicode_READ(kind, data, i);
-            *p++ = (char) ch;
+        while (hi) {
+            pout[size++] = hi % _PyLong_DECIMAL_BASE;
+            hi /= _PyLong_DECIMAL_BASE;
         }
-        (*bytes_str) = p;
-        goto success;
-    }
-    else {
-        *p_output = Py_NewRef(s);
-        goto success;
+        /* check for keyboard interrupt */
+        SIGCHECK({
+                return -1;
+            });
     }
+    return size;
+}
 
-error:
-        Py_DECREF(mod);
-        Py_XDECREF(s);
-        return -1;
+/* Divide-and-conquer version of decimal_digits_schoolbook(), filling exactly
+   width digits of pout, with leading zeros.  abs(a) must be less than
+   _PyLong_DECIMAL_BASE ** width.  Splitting a with a division by a power of
+   _PyLong_DECIMAL_BASE, the conversion costs a few large divisions instead
+   of a quadratic number of digit operations.  Returns 0 on success, -1 on
+   failure. */
+static int
+decimal_digits_dc(PyLongObject *a, digit *pout, Py_ssize_t width,
+                  pow_cache *cache)
+{
+    PyLongObject *pow, *hi, *lo;
+    Py_ssize_t k;
+    int res;
 
-success:
-        Py_DECREF(mod);
-        Py_DECREF(s);
+    if (_PyLong_DigitCount(a) <= STR_DC_CUTOFF) {
+        Py_ssize_t size = decimal_digits_schoolbook(a, pout);
+        if (size < 0)
+            return -1;
+        assert(size <= width);
+        memset(pout + size, 0, (width - size) * sizeof(digit));
         return 0;
+    }
+    k = width >> 1;
+    pow = pow_cache_get(cache, k);
+    if (pow == NULL)
+        return -1;
+    if (long_divrem(a, pow, &hi, &lo) < 0)
+        return -1;
+    res = decimal_digits_dc(lo, pout, k, cache);
+    Py_DECREF(lo);
+    if (res == 0)
+        res = decimal_digits_dc(hi, pout + k, width - k, cache);
+    Py_DECREF(hi);
+    return res;
 }
-#endif /* WITH_PYLONG_MODULE */
 
 /* Convert an integer to a base 10 string.  Returns a new non-shared
    string.  (Return value is non-shared so that callers can modify the
@@ -2095,7 +2190,7 @@ long_to_decimal_string_internal(PyObject *aa,
     PyLongObject *scratch, *a;
     PyObject *str = NULL;
     Py_ssize_t size, strlen, size_a, i, j;
-    digit *pout, *pin, rem, tenpow;
+    digit *pout, rem, tenpow;
     int negative;
     int d;
 
@@ -2127,17 +2222,6 @@ long_to_decimal_string_internal(PyObject *aa,
         }
     }
 
-#if WITH_PYLONG_MODULE
-    if (size_a > 1000) {
-        /* Switch to _pylong.int_to_decimal_string(). */
-        return pylong_int_to_decimal_string(aa,
-                                         p_output,
-                                         writer,
-                                         bytes_writer,
-                                         bytes_str);
-    }
-#endif
-
     /* quick and dirty upper bound for the number of digits
        required to express a in base _PyLong_DECIMAL_BASE:
 
@@ -2161,28 +2245,24 @@ long_to_decimal_string_internal(PyObject *aa,
         return -1;
 
     /* convert array of base _PyLong_BASE digits in pin to an array of
-       base _PyLong_DECIMAL_BASE digits in pout, following Knuth (TAOCP,
-       Volume 2 (3rd edn), section 4.4, Method 1b). */
-    pin = a->long_value.ob_digit;
+       base _PyLong_DECIMAL_BASE digits in pout */
     pout = scratch->long_value.ob_digit;
-    size = 0;
-    for (i = size_a; --i >= 0; ) {
-        digit hi = pin[i];
-        for (j = 0; j < size; j++) {
-            twodigits z = (twodigits)pout[j] << PyLong_SHIFT | hi;
-            hi = (digit)(z / _PyLong_DECIMAL_BASE);
-            pout[j] = (digit)(z - (twodigits)hi *
-                              _PyLong_DECIMAL_BASE);
+    if (size_a <= STR_DC_CUTOFF) {
+        size = decimal_digits_schoolbook(a, pout);
+    }
+    else {
+        pow_cache cache = {.base = _PyLong_DECIMAL_BASE, .len = 0};
+        if (decimal_digits_dc(a, pout, size, &cache) < 0) {
+            size = -1;
         }
-        while (hi) {
-            pout[size++] = hi % _PyLong_DECIMAL_BASE;
-            hi /= _PyLong_DECIMAL_BASE;
+        while (size > 1 && pout[size - 1] == 0) {
+            size--;
         }
-        /* check for keyboard interrupt */
-        SIGCHECK({
-                Py_DECREF(scratch);
-                return -1;
-            });
+        pow_cache_clear(&cache);
+    }
+    if (size < 0) {
+        Py_DECREF(scratch);
+        return -1;
     }
     /* pout should have at least one digit, so that the case when a = 0
        works correctly */
@@ -2641,40 +2721,6 @@ long_from_binary_base(const char *start, const char *end, Py_ssize_t digits, int
     return 0;
 }
 
-#ifdef WITH_PYLONG_MODULE
-/* asymptotically faster str-to-long conversion for base 10, using _pylong.py */
-static int
-pylong_int_from_string(const char *start, const char *end, PyLongObject **res)
-{
-    PyObject *mod = PyImport_ImportModule("_pylong");
-    if (mod == NULL) {
-        goto error;
-    }
-    PyObject *s = PyUnicode_FromStringAndSize(start, end-start);
-    if (s == NULL) {
-        Py_DECREF(mod);
-        goto error;
-    }
-    PyObject *result = PyObject_CallMethod(mod, "int_from_string", "O", s);
-    Py_DECREF(s);
-    Py_DECREF(mod);
-    if (result == NULL) {
-        goto error;
-    }
-    if (!PyLong_Check(result)) {
-        Py_DECREF(result);
-        PyErr_SetString(PyExc_TypeError,
-                        "_pylong.int_from_string did not return an int");
-        goto error;
-    }
-    *res = (PyLongObject *)result;
-    return 0;
-error:
-    *res = NULL;
-    return 0;  // See the long_from_string_base() API comment.
-}
-#endif /* WITH_PYLONG_MODULE */
-
 /***
 long_from_non_binary_base: parameters and return values are the same as
 long_from_binary_base.
@@ -2928,6 +2974,72 @@ long_from_non_binary_base(const char *start, const char *end, Py_ssize_t digits,
     return 0;
 }
 
+/* Convert the n digits starting at start, with no underscores, by splitting
+   them in halves recursively, and joining the halves with a multiplication by
+   a power of the base.  Return a new reference, or NULL on failure. */
+static PyLongObject *
+long_from_non_binary_base_dc_inner(const char *start, Py_ssize_t n, int base,
+                                   pow_cache *cache)
+{
+    PyLongObject *z, *lo, *pow;
+    Py_ssize_t k;
+
+    if (n <= FROM_STR_DC_CUTOFF) {
+        (void)long_from_non_binary_base(start, start + n, n, base, &z);
+        return z;
+    }
+    k = n >> 1;
+    pow = pow_cache_get(cache, k);
+    if (pow == NULL)
+        return NULL;
+    z = long_from_non_binary_base_dc_inner(start, n - k, base, cache);
+    if (z == NULL)
+        return NULL;
+    Py_SETREF(z, long_mul(z, pow));
+    if (z == NULL)
+        return NULL;
+    lo = long_from_non_binary_base_dc_inner(start + n - k, k, base, cache);
+    if (lo == NULL) {
+        Py_DECREF(z);
+        return NULL;
+    }
+    Py_SETREF(z, long_add(z, lo));
+    Py_DECREF(lo);
+    return z;
+}
+
+/* Subquadratic version of long_from_non_binary_base() for long strings,
+   with the same parameters and return values.  Its running time is that of
+   the multiplications of the top levels, so it benefits from the Karatsuba
+   and Toom-Cook algorithms. */
+static int
+long_from_non_binary_base_dc(const char *start, const char *end, Py_ssize_t digits, int base, PyLongObject **res)
+{
+    char *buf = NULL;
+
+    if (end - start != digits) {
+        /* Drop the underscores, so that the string can be split anywhere. */
+        char *q = buf = PyMem_Malloc(digits);
+        if (buf == NULL) {
+            PyErr_NoMemory();
+            *res = NULL;
+            return 0;
+        }
+        for (const char *p = start; p < end; p++) {
+            if (*p != '_') {
+                *q++ = *p;
+            }
+        }
+        assert(q == buf + digits);
+        start = buf;
+    }
+    pow_cache cache = {.base = (digit)base, .len = 0};
+    *res = long_from_non_binary_base_dc_inner(start, digits, base, &cache);
+    pow_cache_clear(&cache);
+    PyMem_Free(buf);
+    return 0;
+}
+
 /* *str points to the first digit in a string of base `base` digits. base is an
  * integer from 2 to 36 inclusive. Here we don't need to worry about prefixes
  * like 0x or leading +- signs. The string should be null terminated consisting
@@ -2936,13 +3048,13 @@ long_from_non_binary_base(const char *start, const char *end, Py_ssize_t digits,
  *
  * If base is a power of 2 then the complexity is linear in the number of
  * characters in the string. Otherwise a quadratic algorithm is used for
- * non-binary bases.
+ * short strings of non-binary bases, and a divide-and-conquer one for long
+ * strings.
  *
  * Return values:
  *
  *   - Returns -1 on syntax error (exception needs to be set, *res is untouched)
- *   - Returns 0 and sets *res to NULL for MemoryError, OverflowError, or
- *     _pylong.int_from_string() errors.
+ *   - Returns 0 and sets *res to NULL for MemoryError or OverflowError.
  *   - Returns 0 and sets *res to an unsigned, unnormalized PyLong (success!).
  *
  * Afterwards *str is set to point to the first non-digit (which may be *str!).
@@ -3021,12 +3133,9 @@ long_from_string_base(const char **str, int base, PyLongObject **res)
                 return 0;
             }
         }
-#if WITH_PYLONG_MODULE
-        if (digits > 6000 && base == 10) {
-            /* Switch to _pylong.int_from_string() */
-            return pylong_int_from_string(start, end, res);
+        if (digits > FROM_STR_DC_CUTOFF) {
+            return long_from_non_binary_base_dc(start, end, digits, base, res);
         }
-#endif
         /* Use the quadratic algorithm for non binary bases. */
         return long_from_non_binary_base(start, end, digits, base, res);
     }
@@ -3236,7 +3345,10 @@ long_divrem(PyLongObject *a, PyLongObject *b,
         }
     }
     else {
-        z = x_divrem(a, b, prem);
+        if (USE_BZ_DIVISION(size_a, size_b))
+            z = x_divrem_bz(a, b, prem);
+        else
+            z = x_divrem(a, b, prem);
         *prem = maybe_small_long(*prem);
         if (z == NULL)
             return -1;
@@ -3290,7 +3402,10 @@ long_rem(PyLongObject *a, PyLongObject *b, PyLongObject **prem)
     }
     else {
         /* Slow path using divrem. */
-        Py_XDECREF(x_divrem(a, b, prem));
+        if (USE_BZ_DIVISION(size_a, size_b))
+            Py_XDECREF(x_divrem_bz(a, b, prem));
+        else
+            Py_XDECREF(x_divrem(a, b, prem));
         *prem = maybe_small_long(*prem);
         if (*prem == NULL)
             return -1;
@@ -3917,6 +4032,25 @@ _PyCompactLong_Subtract(PyLongObject *a, PyLongObject *b)
     return medium_from_stwodigits(v);
 }
 
+void
+_PyCompactLong_InplaceStore(PyObject **pv, Py_ssize_t x)
+{
+    PyLongObject *v = (PyLongObject *)*pv;
+    assert(_PyLong_CheckExactAndCompact((PyObject *)v));
+    assert(_PyLong_IsCompactValue(x));
+    /* If the caller holds the only reference, v is a mortal int that
+       nobody else can observe, so it can be overwritten in place unless
+       x has to come from the small int cache. */
+    if (!IS_SMALL_INT(x) && _PyObject_IsUniquelyReferenced((PyObject *)v)) {
+        assert(!_Py_IsImmortal(v));
+        digit abs_x = x < 0 ? (digit)(-x) : (digit)x;
+        _PyLong_SetSignAndDigitCount(v, x<0?-1:1, 1);
+        v->long_value.ob_digit[0] = abs_x;
+        return;
+    }
+    Py_SETREF(*pv, (PyObject *)_PyLong_FromSTwoDigits(x));
+}
+
 static PyObject *
 long_sub_method(PyObject *a, PyObject *b)
 {
@@ -4061,6 +4195,419 @@ kmul_split(PyLongObject *n,
     return 0;
 }
 
+/* Multiplication by number-theoretic transforms (NTT).
+ *
+ * The digits of a and b are the coefficients of two polynomials, whose
+ * product is computed modulo three primes p with large power-of-2 factors
+ * in p-1, by cyclic convolutions of length n, a power of 2 at least
+ * asize+bsize.  Each convolution is a forward transform of both inputs, a
+ * pointwise product and an inverse transform, in O(n log n) operations.  The
+ * coefficients of the product are less than n * PyLong_BASE**2 < 2**86,
+ * within the product of the primes, so they are reconstructed exactly with
+ * the Chinese remainder theorem and the carries propagated into the result.
+ *
+ * Arithmetic modulo p uses Montgomery reduction with R = 2**32: values are
+ * kept reduced in [0, p), and the roots of unity are stored premultiplied by
+ * R, so that ntt_redc(x * w) gives x * w mod p.
+ */
+#define NTT_MAX_LOG2 26
+
+typedef struct {
+    uint32_t p;         /* the prime, with 2**NTT_MAX_LOG2 dividing p-1 */
+    uint32_t g;         /* a primitive root modulo p */
+    uint32_t pinv;      /* -p**-1 mod 2**32 */
+} ntt_prime;
+
+static const ntt_prime ntt_primes[3] = {
+    {2013265921, 31, 2013265919},       /* 15 * 2**27 + 1 */
+    {1811939329, 13, 1811939327},       /* 27 * 2**26 + 1 */
+    {469762049, 3, 469762047},          /* 7 * 2**26 + 1 */
+};
+
+static inline uint32_t
+ntt_redc(uint64_t t, const ntt_prime *P)
+{
+    uint32_t m = (uint32_t)t * P->pinv;
+    uint32_t r = (uint32_t)((t + (uint64_t)m * P->p) >> 32);
+    return r >= P->p ? r - P->p : r;
+}
+
+static uint32_t
+ntt_powmod(uint64_t x, uint64_t e, uint32_t p)
+{
+    uint64_t r = 1;
+    x %= p;
+    while (e) {
+        if (e & 1)
+            r = r * x % p;
+        x = x * x % p;
+        e >>= 1;
+    }
+    return (uint32_t)r;
+}
+
+/* Fill roots[0:n/2] with the powers of w, in Montgomery form. */
+static void
+ntt_roots(uint32_t *roots, Py_ssize_t n, uint32_t w, const ntt_prime *P)
+{
+    uint64_t x = ((uint64_t)1 << 32) % P->p;
+    for (Py_ssize_t j = 0; j < n / 2; j++) {
+        roots[j] = (uint32_t)x;
+        x = x * w % P->p;
+    }
+}
+
+/* Decimation-in-frequency forward transform: natural order in, bit-reversed
+   order out. */
+static void
+ntt_forward(uint32_t *x, Py_ssize_t n, const uint32_t *roots,
+            const ntt_prime *P)
+{
+    const uint32_t p = P->p;
+    for (Py_ssize_t len = n / 2, stride = 1; len >= 1; len >>= 1, stride <<= 1) {
+        for (Py_ssize_t i = 0; i < n; i += 2 * len) {
+            uint32_t *x0 = x + i, *x1 = x + i + len;
+            for (Py_ssize_t j = 0; j < len; j++) {
+                uint32_t u = x0[j], v = x1[j];
+                uint32_t s = u + v;
+                x0[j] = s >= p ? s - p : s;
+                x1[j] = ntt_redc((uint64_t)(u + p - v) * roots[j * stride], P);
+            }
+        }
+    }
+}
+
+/* Decimation-in-time inverse transform, without the scaling by 1/n:
+   bit-reversed order in, natural order out. */
+static void
+ntt_inverse(uint32_t *x, Py_ssize_t n, const uint32_t *roots,
+            const ntt_prime *P)
+{
+    const uint32_t p = P->p;
+    for (Py_ssize_t len = 1, stride = n / 2; len < n; len <<= 1, stride >>= 1) {
+        for (Py_ssize_t i = 0; i < n; i += 2 * len) {
+            uint32_t *x0 = x + i, *x1 = x + i + len;
+            for (Py_ssize_t j = 0; j < len; j++) {
+                uint32_t u = x0[j];
+                uint32_t v = ntt_redc((uint64_t)x1[j] * roots[j * stride], P);
+                uint32_t s = u + v;
+                x0[j] = s >= p ? s - p : s;
+                x1[j] = u >= v ? u - v : u + p - v;
+            }
+        }
+    }
+}
+
+/* Store the cyclic convolution of a and b modulo P->p into out[0:n]. */
+static void
+ntt_convolve(PyLongObject *a, PyLongObject *b, uint32_t *out, uint32_t *tmp,
+             uint32_t *roots, Py_ssize_t n, int log2n, const ntt_prime *P)
+{
+    const Py_ssize_t asize = _PyLong_DigitCount(a);
+    const Py_ssize_t bsize = _PyLong_DigitCount(b);
+    const uint32_t p = P->p;
+    uint32_t w, scale;
+    Py_ssize_t i;
+
+    for (i = 0; i < asize; i++) {
+        out[i] = a->long_value.ob_digit[i] % p;
+    }
+    memset(out + asize, 0, (n - asize) * sizeof(uint32_t));
+    w = ntt_powmod(P->g, (p - 1) >> log2n, p);
+    ntt_roots(roots, n, w, P);
+    ntt_forward(out, n, roots, P);
+    if (a == b) {
+        for (i = 0; i < n; i++) {
+            out[i] = ntt_redc((uint64_t)out[i] * out[i], P);
+        }
+    }
+    else {
+        for (i = 0; i < bsize; i++) {
+            tmp[i] = b->long_value.ob_digit[i] % p;
+        }
+        memset(tmp + bsize, 0, (n - bsize) * sizeof(uint32_t));
+        ntt_forward(tmp, n, roots, P);
+        for (i = 0; i < n; i++) {
+            out[i] = ntt_redc((uint64_t)out[i] * tmp[i], P);
+        }
+    }
+    /* The pointwise products carry a factor 1/R, and the inverse transform
+       a factor n: multiply by R/n, that is, by R**2/n in Montgomery form. */
+    ntt_roots(roots, n, ntt_powmod(w, p - 2, p), P);
+    ntt_inverse(out, n, roots, P);
+    scale = ntt_powmod(((uint64_t)1 << 32) % p, 2, p);
+    scale = (uint32_t)((uint64_t)scale * ntt_powmod(n, p - 2, p) % p);
+    for (i = 0; i < n; i++) {
+        out[i] = ntt_redc((uint64_t)out[i] * scale, P);
+    }
+}
+
+/* NTT multiplication.  Ignores the input signs, and returns the absolute
+ * value of the product (or NULL if error).  The caller ensures that
+ * asize + bsize <= 2**NTT_MAX_LOG2.
+ */
+static PyLongObject *
+ntt_mul(PyLongObject *a, PyLongObject *b)
+{
+    const Py_ssize_t asize = _PyLong_DigitCount(a);
+    const Py_ssize_t bsize = _PyLong_DigitCount(b);
+    const Py_ssize_t size = asize + bsize;
+    const ntt_prime *P = ntt_primes;
+    PyLongObject *ret;
+    uint32_t *buf, *r[3], *tmp, *roots;
+    Py_ssize_t n, i;
+    int log2n;
+
+    for (log2n = 1, n = 2; n < size; log2n++, n <<= 1)
+        ;
+    assert(log2n <= NTT_MAX_LOG2);
+    ret = long_alloc(size);
+    if (ret == NULL)
+        return NULL;
+    buf = PyMem_New(uint32_t, 4 * n + n / 2);
+    if (buf == NULL) {
+        Py_DECREF(ret);
+        return (PyLongObject *)PyErr_NoMemory();
+    }
+    r[0] = buf;
+    r[1] = buf + n;
+    r[2] = buf + 2 * n;
+    tmp = buf + 3 * n;
+    roots = buf + 4 * n;
+    for (i = 0; i < 3; i++) {
+        ntt_convolve(a, b, r[i], tmp, roots, n, log2n, &P[i]);
+        SIGCHECK({
+                PyMem_Free(buf);
+                Py_DECREF(ret);
+                return NULL;
+            });
+    }
+
+    /* Recombine with Garner's algorithm: the coefficient is
+     *     x = v0 + p0 * (v1 + p1 * v2)
+     * with v0 = r0, v1 = (r1 - v0) / p0 mod p1, and
+     * v2 = ((r2 - v0) / p0 - v1) / p1 mod p2.  Then add it to the carry,
+     * kept as a 128-bit number in two halves.
+     */
+    const uint64_t p0 = P[0].p, p1 = P[1].p, p2 = P[2].p;
+    const uint64_t inv_p0_p1 = ntt_powmod(p0, p1 - 2, (uint32_t)p1);
+    const uint64_t inv_p0_p2 = ntt_powmod(p0, p2 - 2, (uint32_t)p2);
+    const uint64_t inv_p1_p2 = ntt_powmod(p1, p2 - 2, (uint32_t)p2);
+    const uint64_t p0p1 = p0 * p1;
+    uint64_t lo = 0, hi = 0;
+    for (i = 0; i < size; i++) {
+        uint64_t v0 = r[0][i];
+        uint64_t v1 = (r[1][i] + p1 - v0 % p1) * inv_p0_p1 % p1;
+        uint64_t v2 = (r[2][i] + p2 - v0 % p2) * inv_p0_p2 % p2;
+        v2 = (v2 + p2 - v1 % p2) * inv_p1_p2 % p2;
+        /* lo:hi += v0 + p0*v1 + p0p1*v2; p0p1*v2 < 2**91 is computed
+           from its 32-bit halves. */
+        uint64_t t = v0 + p0 * v1;
+        uint64_t m_lo = (p0p1 & 0xFFFFFFFFU) * v2;
+        uint64_t m_hi = (p0p1 >> 32) * v2;
+        uint64_t s = m_lo + (m_hi << 32);
+        hi += (m_hi >> 32) + (s < m_lo);
+        s += t;
+        hi += s < t;
+        lo += s;
+        hi += lo < s;
+        ret->long_value.ob_digit[i] = (digit)(lo & PyLong_MASK);
+        lo = (lo >> PyLong_SHIFT) | (hi << (64 - PyLong_SHIFT));
+        hi >>= PyLong_SHIFT;
+    }
+    assert(lo == 0 && hi == 0);
+    PyMem_Free(buf);
+    return long_normalize(ret);
+}
+
+/* Return a new int holding digits [lo:hi] of abs(n), clipped to the size of
+   n.  Digits are counted from the least significant one.  Returns NULL on
+   failure.
+*/
+static PyLongObject *
+long_digit_slice(PyLongObject *n, Py_ssize_t lo, Py_ssize_t hi)
+{
+    const Py_ssize_t size_n = _PyLong_DigitCount(n);
+    PyLongObject *z;
+
+    assert(0 <= lo && lo <= hi);
+    hi = Py_MIN(hi, size_n);
+    lo = Py_MIN(lo, hi);
+    z = long_alloc(hi - lo);
+    if (z == NULL)
+        return NULL;
+    memcpy(z->long_value.ob_digit, n->long_value.ob_digit + lo,
+           (hi - lo) * sizeof(digit));
+    return long_normalize(z);
+}
+
+/* Exact division of a by 3, keeping the sign.  The caller guarantees that
+   3 divides a. */
+static PyLongObject *
+long_divexact3(PyLongObject *a)
+{
+    digit rem;
+    PyLongObject *z = divrem1(a, 3, &rem);
+    assert(rem == 0);
+    if (z != NULL && _PyLong_IsNegative(a) && !_PyLong_IsZero(z)) {
+        _PyLong_FlipSign(z);
+    }
+    return z;
+}
+
+/* Evaluate the polynomial x2*t**2 + x1*t + x0, with x split into k-digit
+   pieces, at the points 0, 1, -1, -2 and infinity, storing new references
+   into v[0:5].  Returns 0 on success, -1 on failure.
+*/
+static int
+toom3_eval(PyLongObject *x, Py_ssize_t k, PyLongObject *v[5])
+{
+    PyLongObject *x1 = NULL, *p = NULL, *t = NULL;
+
+    v[0] = v[1] = v[2] = v[3] = v[4] = NULL;
+    if ((v[0] = long_digit_slice(x, 0, k)) == NULL) goto fail;
+    if ((x1 = long_digit_slice(x, k, 2*k)) == NULL) goto fail;
+    if ((v[4] = long_digit_slice(x, 2*k, PY_SSIZE_T_MAX)) == NULL) goto fail;
+
+    /* p = x0 + x2; x(1) = p + x1; x(-1) = p - x1 */
+    if ((p = x_add(v[0], v[4])) == NULL) goto fail;
+    if ((v[1] = x_add(p, x1)) == NULL) goto fail;
+    if ((v[2] = long_sub(p, x1)) == NULL) goto fail;
+    Py_CLEAR(p);
+    Py_CLEAR(x1);
+
+    /* x(-2) = 2*(x(-1) + x2) - x0 */
+    if ((p = long_add(v[2], v[4])) == NULL) goto fail;
+    if ((t = (PyLongObject *)long_lshift1(p, 0, 1)) == NULL) goto fail;
+    if ((v[3] = long_sub(t, v[0])) == NULL) goto fail;
+    Py_DECREF(t);
+    Py_DECREF(p);
+    return 0;
+
+  fail:
+    Py_XDECREF(x1);
+    Py_XDECREF(p);
+    for (int i = 0; i < 5; i++) {
+        Py_CLEAR(v[i]);
+    }
+    return -1;
+}
+
+/* Toom-Cook 3-way multiplication.  Ignores the input signs, and returns the
+ * absolute value of the product (or NULL if error).
+ *
+ * Each input is split into three k-digit pieces, viewed as the coefficients
+ * of a degree 2 polynomial evaluated at t = BASE**k.  The product polynomial
+ * has degree 4, so it is determined by its values at five points; those take
+ * five multiplications of numbers about a third of the size, instead of the
+ * nine of the schoolbook method.
+ * The points and the interpolation sequence are those of Bodrato, "Towards
+ * Optimal Toom-Cook Multiplication for Univariate and Multivariate
+ * Polynomials in Characteristic 2 and 0" (WAIFI 2007).
+ *
+ * The caller ensures that asize <= bsize and that a has more than 2*k
+ * digits, so that neither split is degenerate.
+ */
+static PyLongObject *
+toom3_mul(PyLongObject *a, PyLongObject *b)
+{
+    const Py_ssize_t asize = _PyLong_DigitCount(a);
+    const Py_ssize_t bsize = _PyLong_DigitCount(b);
+    const Py_ssize_t k = (bsize + 2) / 3;
+    PyLongObject *va[5], *vb[5], *r[5] = {NULL};
+    PyLongObject *t = NULL, *u = NULL;
+    PyLongObject *ret = NULL;
+    Py_ssize_t i, size;
+
+    assert(asize <= bsize);
+    assert(asize > 2 * k);
+
+    if (toom3_eval(a, k, va) < 0)
+        return NULL;
+    if (a == b) {
+        for (i = 0; i < 5; i++) {
+            vb[i] = (PyLongObject *)Py_NewRef(va[i]);
+        }
+    }
+    else if (toom3_eval(b, k, vb) < 0) {
+        for (i = 0; i < 5; i++) {
+            Py_DECREF(va[i]);
+        }
+        return NULL;
+    }
+
+    /* Pointwise products.  Passing the same object twice keeps the
+       squaring fast path in k_mul. */
+    for (i = 0; i < 5; i++) {
+        r[i] = long_mul(va[i], a == b ? va[i] : vb[i]);
+        Py_CLEAR(va[i]);
+        Py_CLEAR(vb[i]);
+        if (r[i] == NULL) {
+            for (i++; i < 5; i++) {
+                Py_DECREF(va[i]);
+                Py_DECREF(vb[i]);
+            }
+            goto fail;
+        }
+    }
+
+    /* Interpolate.  On entry r[0:5] hold the values at 0, 1, -1, -2 and
+       infinity.  On exit they hold the coefficients of t**0 .. t**4. */
+    /* r3 = (r(-2) - r(1)) / 3 */
+    if ((t = long_sub(r[3], r[1])) == NULL) goto fail;
+    Py_SETREF(r[3], long_divexact3(t));
+    Py_CLEAR(t);
+    if (r[3] == NULL) goto fail;
+    /* r1 = (r(1) - r(-1)) / 2 */
+    if ((t = long_sub(r[1], r[2])) == NULL) goto fail;
+    Py_SETREF(r[1], (PyLongObject *)long_rshift1(t, 0, 1));
+    Py_CLEAR(t);
+    if (r[1] == NULL) goto fail;
+    /* r2 = r(-1) - r(0) */
+    Py_SETREF(r[2], long_sub(r[2], r[0]));
+    if (r[2] == NULL) goto fail;
+    /* r3 = (r2 - r3) / 2 + 2*r(inf) */
+    if ((t = long_sub(r[2], r[3])) == NULL) goto fail;
+    Py_SETREF(t, (PyLongObject *)long_rshift1(t, 0, 1));
+    if (t == NULL) goto fail;
+    if ((u = (PyLongObject *)long_lshift1(r[4], 0, 1)) == NULL) goto fail;
+    Py_SETREF(r[3], long_add(t, u));
+    Py_CLEAR(t);
+    Py_CLEAR(u);
+    if (r[3] == NULL) goto fail;
+    /* r2 = r2 + r1 - r(inf) */
+    if ((t = long_add(r[2], r[1])) == NULL) goto fail;
+    Py_SETREF(r[2], long_sub(t, r[4]));
+    Py_CLEAR(t);
+    if (r[2] == NULL) goto fail;
+    /* r1 = r1 - r3 */
+    Py_SETREF(r[1], long_sub(r[1], r[3]));
+    if (r[1] == NULL) goto fail;
+
+    /* Recompose.  The inputs are nonnegative, so all the coefficients are
+       too, and each one fits in the result at its offset. */
+    size = asize + bsize;
+    ret = long_alloc(size);
+    if (ret == NULL) goto fail;
+    memset(ret->long_value.ob_digit, 0, size * sizeof(digit));
+    for (i = 0; i < 5; i++) {
+        assert(!_PyLong_IsNegative(r[i]));
+        assert(i * k + _PyLong_DigitCount(r[i]) <= size);
+        (void)v_iadd(ret->long_value.ob_digit + i * k, size - i * k,
+                     r[i]->long_value.ob_digit, _PyLong_DigitCount(r[i]));
+        Py_CLEAR(r[i]);
+    }
+    return long_normalize(ret);
+
+  fail:
+    Py_XDECREF(t);
+    Py_XDECREF(u);
+    for (i = 0; i < 5; i++) {
+        Py_XDECREF(r[i]);
+    }
+    return NULL;
+}
+
 static PyLongObject *k_lopsided_mul(PyLongObject *a, PyLongObject *b);
 
 /* Karatsuba multiplication.  Ignores the input signs, and returns the
@@ -4120,6 +4667,18 @@ k_mul(PyLongObject *a, PyLongObject *b)
     if (2 * asize <= bsize)
         return k_lopsided_mul(a, b);
 
+    /* Multiply by number-theoretic transforms when both inputs are huge. */
+    if (asize > NTT_CUTOFF && asize + bsize <= ((Py_ssize_t)1 << NTT_MAX_LOG2))
+        return ntt_mul(a, b);
+
+    /* Switch to Toom-Cook 3-way splitting when b splits into three pieces
+     * of which a has more than two.  That cuts the work of large balanced
+     * products further, and is where most of the digits go in int/str
+     * conversions and division of huge numbers.
+     */
+    if (asize > TOOM3_CUTOFF && asize > 2 * ((bsize + 2) / 3))
+        return toom3_mul(a, b);
+
     /* Split a & b into hi & lo pieces. */
     shift = bsize >> 1;
     if (kmul_split(a, shift, &ah, &al) < 0) goto fail;
@@ -4375,6 +4934,244 @@ long_mul_method(PyObject *a, PyObject *b)
     return (PyObject*)long_mul((PyLongObject*)a, (PyLongObject*)b);
 }
 
+/* Return abs(hi) * BASE**n + abs(lo), where abs(lo) < BASE**n. */
+static PyLongObject *
+long_digit_concat(PyLongObject *hi, PyLongObject *lo, Py_ssize_t n)
+{
+    const Py_ssize_t size_hi = _PyLong_DigitCount(hi);
+    const Py_ssize_t size_lo = _PyLong_DigitCount(lo);
+    PyLongObject *z;
+
+    assert(size_lo <= n);
+    z = long_alloc(size_hi ? n + size_hi : size_lo);
+    if (z == NULL)
+        return NULL;
+    memcpy(z->long_value.ob_digit, lo->long_value.ob_digit,
+           size_lo * sizeof(digit));
+    if (size_hi) {
+        memset(z->long_value.ob_digit + size_lo, 0,
+               (n - size_lo) * sizeof(digit));
+        memcpy(z->long_value.ob_digit + n, hi->long_value.ob_digit,
+               size_hi * sizeof(digit));
+    }
+    return long_normalize(z);
+}
+
+/* Burnikel-Ziegler recursive division, after "Fast Recursive Division"
+   (Christoph Burnikel and Joachim Ziegler, MPI-I-98-1-022, 1998).  This is
+   the algorithm of _pylong.int_divmod(), working on whole digits.
+
+   bz_div2n1n() divides a by b, where b has exactly n digits, its top digit is
+   at least PyLong_BASE/2, and 0 <= a < b * BASE**n.  It stores the quotient
+   and the remainder into *pq and *pr, and returns 0, or returns -1 on
+   failure.  The two halves of the quotient are computed by bz_div3n2n(),
+   which needs one half-size division and one half-size multiplication.
+*/
+static int bz_div3n2n(PyLongObject *a12, PyLongObject *a3, PyLongObject *b,
+                      PyLongObject *b1, PyLongObject *b2, Py_ssize_t n,
+                      PyLongObject **pq, PyLongObject **pr);
+
+static int
+bz_div2n1n(PyLongObject *a, PyLongObject *b, Py_ssize_t n,
+           PyLongObject **pq, PyLongObject **pr)
+{
+    PyLongObject *b1 = NULL, *b2 = NULL, *a12 = NULL, *a3 = NULL;
+    PyLongObject *q1 = NULL, *q2 = NULL, *r = NULL;
+    Py_ssize_t half;
+    int pad;
+
+    assert(_PyLong_DigitCount(b) == n);
+    if (_PyLong_DigitCount(a) - n <= BZ_CUTOFF) {
+        return long_divrem(a, b, pq, pr);
+    }
+
+    /* Make n even, so that the halves have the same size. */
+    pad = n & 1;
+    if (pad) {
+        a = (PyLongObject *)long_lshift1(a, 1, 0);
+        if (a == NULL)
+            return -1;
+        b = (PyLongObject *)long_lshift1(b, 1, 0);
+        if (b == NULL) {
+            Py_DECREF(a);
+            return -1;
+        }
+        n++;
+    }
+    half = n >> 1;
+    if ((b1 = long_digit_slice(b, half, n)) == NULL) goto fail;
+    if ((b2 = long_digit_slice(b, 0, half)) == NULL) goto fail;
+    if ((a12 = long_digit_slice(a, n, PY_SSIZE_T_MAX)) == NULL) goto fail;
+    if ((a3 = long_digit_slice(a, half, n)) == NULL) goto fail;
+    if (bz_div3n2n(a12, a3, b, b1, b2, half, &q1, &r) < 0) goto fail;
+    Py_SETREF(a12, r);
+    r = NULL;
+    Py_SETREF(a3, long_digit_slice(a, 0, half));
+    if (a3 == NULL) goto fail;
+    if (bz_div3n2n(a12, a3, b, b1, b2, half, &q2, &r) < 0) goto fail;
+    if (pad) {
+        Py_SETREF(r, (PyLongObject *)long_rshift1(r, 1, 0));
+        if (r == NULL) goto fail;
+    }
+    *pq = long_digit_concat(q1, q2, half);
+    if (*pq == NULL) goto fail;
+    *pr = r;
+    Py_DECREF(q1);
+    Py_DECREF(q2);
+    Py_DECREF(a12);
+    Py_DECREF(a3);
+    Py_DECREF(b1);
+    Py_DECREF(b2);
+    if (pad) {
+        Py_DECREF(a);
+        Py_DECREF(b);
+    }
+    return 0;
+
+  fail:
+    Py_XDECREF(q1);
+    Py_XDECREF(q2);
+    Py_XDECREF(r);
+    Py_XDECREF(a12);
+    Py_XDECREF(a3);
+    Py_XDECREF(b1);
+    Py_XDECREF(b2);
+    if (pad) {
+        Py_DECREF(a);
+        Py_DECREF(b);
+    }
+    return -1;
+}
+
+/* Divide a12 * BASE**n + a3 by b = b1 * BASE**n + b2, where b1 and b2 have
+   n digits, a3 < BASE**n and the quotient fits in n digits. */
+static int
+bz_div3n2n(PyLongObject *a12, PyLongObject *a3, PyLongObject *b,
+           PyLongObject *b1, PyLongObject *b2, Py_ssize_t n,
+           PyLongObject **pq, PyLongObject **pr)
+{
+    PyLongObject *q = NULL, *r = NULL, *t;
+
+    t = long_digit_slice(a12, n, PY_SSIZE_T_MAX);
+    if (t == NULL)
+        return -1;
+    if (long_compare(t, b1) == 0) {
+        /* The quotient estimate a12 // b1 would overflow n digits;
+           q = BASE**n - 1, r = a12 - b1 * BASE**n + b1 instead. */
+        Py_DECREF(t);
+        if ((q = long_alloc(n)) == NULL) goto fail;
+        for (Py_ssize_t i = 0; i < n; i++) {
+            q->long_value.ob_digit[i] = PyLong_MASK;
+        }
+        if ((t = long_digit_slice(a12, 0, n)) == NULL) goto fail;
+        r = x_add(t, b1);
+        Py_DECREF(t);
+        if (r == NULL) goto fail;
+    }
+    else {
+        Py_DECREF(t);
+        if (bz_div2n1n(a12, b1, n, &q, &r) < 0)
+            return -1;
+    }
+
+    /* r = r * BASE**n + a3 - q * b2, then correct q by at most 2. */
+    Py_SETREF(r, long_digit_concat(r, a3, n));
+    if (r == NULL) goto fail;
+    if ((t = k_mul(q, b2)) == NULL) goto fail;
+    Py_SETREF(r, long_sub(r, t));
+    Py_DECREF(t);
+    if (r == NULL) goto fail;
+    while (_PyLong_IsNegative(r)) {
+        Py_SETREF(q, long_sub(q, (PyLongObject *)_PyLong_GetOne()));
+        if (q == NULL) goto fail;
+        Py_SETREF(r, long_add(r, b));
+        if (r == NULL) goto fail;
+    }
+    *pq = q;
+    *pr = r;
+    return 0;
+
+  fail:
+    Py_XDECREF(q);
+    Py_XDECREF(r);
+    return -1;
+}
+
+/* Unsigned int division with remainder for large divisors and quotients, with
+   the same interface as x_divrem().  The divisor w is normalized and, viewing
+   v as a sequence of "big digits" with as many digits as w, each big digit is
+   divided in turn with bz_div2n1n().  The running time is dominated by
+   multiplications of the size of the divisor, so this benefits from the
+   Karatsuba and Toom-Cook algorithms, where x_divrem() is quadratic.
+*/
+static PyLongObject *
+x_divrem_bz(PyLongObject *v1, PyLongObject *w1, PyLongObject **prem)
+{
+    PyLongObject *v, *w, *q, *r = NULL, *a = NULL, *qd = NULL;
+    Py_ssize_t size_v, n, i;
+    int d;
+
+    size_v = _PyLong_DigitCount(v1);
+    n = _PyLong_DigitCount(w1);
+    assert(n >= 2 && size_v >= n);
+    *prem = NULL;
+
+    /* normalize: shift w1 left so that its top digit is >= PyLong_BASE/2.
+       shift v1 left by the same amount.  Results go into w and v. */
+    d = PyLong_SHIFT - bit_length_digit(w1->long_value.ob_digit[n-1]);
+    w = long_alloc(n);
+    if (w == NULL)
+        return NULL;
+    (void)v_lshift(w->long_value.ob_digit, w1->long_value.ob_digit, n, d);
+    v = long_alloc(size_v + 1);
+    if (v == NULL) {
+        Py_DECREF(w);
+        return NULL;
+    }
+    v->long_value.ob_digit[size_v] = v_lshift(v->long_value.ob_digit,
+                                              v1->long_value.ob_digit,
+                                              size_v, d);
+    v = long_normalize(v);
+    size_v = _PyLong_DigitCount(v);
+
+    q = long_alloc(size_v);
+    if (q == NULL)
+        goto fail;
+    memset(q->long_value.ob_digit, 0, size_v * sizeof(digit));
+    r = (PyLongObject *)Py_NewRef(_PyLong_GetZero());
+    for (i = (size_v - 1) / n * n; i >= 0; i -= n) {
+        if ((a = long_digit_slice(v, i, i + n)) == NULL) goto fail;
+        Py_SETREF(a, long_digit_concat(r, a, n));
+        if (a == NULL) goto fail;
+        Py_CLEAR(r);
+        if (bz_div2n1n(a, w, n, &qd, &r) < 0) goto fail;
+        Py_CLEAR(a);
+        assert(_PyLong_DigitCount(qd) <= Py_MIN(n, size_v - i));
+        memcpy(q->long_value.ob_digit + i, qd->long_value.ob_digit,
+               _PyLong_DigitCount(qd) * sizeof(digit));
+        Py_CLEAR(qd);
+    }
+    Py_DECREF(v);
+    Py_DECREF(w);
+
+    /* unshift remainder */
+    *prem = (PyLongObject *)long_rshift1(r, 0, d);
+    Py_DECREF(r);
+    if (*prem == NULL) {
+        Py_DECREF(q);
+        return NULL;
+    }
+    return long_normalize(q);
+
+  fail:
+    Py_XDECREF(q);
+    Py_XDECREF(r);
+    Py_XDECREF(a);
+    Py_DECREF(v);
+    Py_DECREF(w);
+    return NULL;
+}
+
 /* Fast modulo division for single-digit longs. */
 static PyObject *
 fast_mod(PyLongObject *a, PyLongObject *b)
@@ -4419,46 +5216,6 @@ fast_floor_div(PyLongObject *a, PyLongObject *b)
     return PyLong_FromLong(div);
 }
 
-#ifdef WITH_PYLONG_MODULE
-/* asymptotically faster divmod, using _pylong.py */
-static int
-pylong_int_divmod(PyLongObject *v, PyLongObject *w,
-                  PyLongObject **pdiv, PyLongObject **pmod)
-{
-    PyObject *mod = PyImport_ImportModule("_pylong");
-    if (mod == NULL) {
-        return -1;
-    }
-    PyObject *result = PyObject_CallMethod(mod, "int_divmod", "OO", v, w);
-    Py_DECREF(mod);
-    if (result == NULL) {
-        return -1;
-    }
-    if (!PyTuple_Check(result)) {
-        Py_DECREF(result);
-        PyErr_SetString(PyExc_ValueError,
-                        "tuple is required from int_divmod()");
-        return -1;
-    }
-    PyObject *q = PyTuple_GET_ITEM(result, 0);
-    PyObject *r = PyTuple_GET_ITEM(result, 1);
-    if (!PyLong_Check(q) || !PyLong_Check(r)) {
-        Py_DECREF(result);
-        PyErr_SetString(PyExc_ValueError,
-                        "tuple of int is required from int_divmod()");
-        return -1;
-    }
-    if (pdiv != NULL) {
-        *pdiv = (PyLongObject *)Py_NewRef(q);
-    }
-    if (pmod != NULL) {
-        *pmod = (PyLongObject *)Py_NewRef(r);
-    }
-    Py_DECREF(result);
-    return 0;
-}
-#endif /* WITH_PYLONG_MODULE */
-
 /* The / and % operators are now defined in terms of divmod().
    The expression a mod b has the value a - b*floor(a/b).
    The long_divrem function gives the remainder after division of
@@ -4510,18 +5267,6 @@ l_divmod(PyLongObject *v, PyLongObject *w,
         }
         return 0;
     }
-#if WITH_PYLONG_MODULE
-    Py_ssize_t size_v = _PyLong_DigitCount(v); /* digits in numerator */
-    Py_ssize_t size_w = _PyLong_DigitCount(w); /* digits in denominator */
-    if (size_w > 300 && (size_v - size_w) > 150) {
-        /* Switch to _pylong.int_divmod().  If the quotient is small then
-          "schoolbook" division is linear-time so don't use in that case.
-          These limits are empirically determined and should be slightly
-          conservative so that _pylong is used in cases it is likely
-          to be faster. See Tools/scripts/divmod_threshold.py. */
-        return pylong_int_divmod(v, w, pdiv, pmod);
-    }
-#endif
     if (long_divrem(v, w, &div, &mod) < 0)
         return -1;
     if ((_PyLong_IsNegative(mod) && _PyLong_IsPositive(w)) ||
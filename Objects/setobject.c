@@ -39,6 +39,7 @@
 #include "pycore_object.h"              // _PyObject_GC_UNTRACK()
 #include "pycore_pyatomic_ft_wrappers.h"  // FT_ATOMIC_LOAD_SSIZE_RELAXED()
 #include "pycore_pyerrors.h"            // _PyErr_SetKeyError()
+#include "pycore_pymem.h"               // PREFETCH_T0()
 #include "pycore_setobject.h"           // _PySet_NextEntry() definition
 #include "pycore_weakref.h"             // FT_CLEAR_WEAKREFS()
 
@@ -1017,18 +1018,106 @@ set_update_dict_lock_held(PySetObject *so, PyObject *other)
     return 0;
 }
 
+/* Bulk insertions from a list or tuple prefetch the table slot of the key
+   this many items ahead. */
+#define SET_PREFETCH_DISTANCE 8
+
+static inline void
+set_prefetch_key(PySetObject *so, PyObject *key)
+{
+    Py_hash_t hash = _PyObject_PeekHash(key);
+    if (hash != -1) {
+        PREFETCH_T0(&so->table[(size_t)hash & so->mask]);
+    }
+}
+
+/* Called before each item of a bulk insertion of `remaining` more items,
+   of which `seen` so far added `added` new keys.  If the next new key would
+   make set_add_entry() resize the table, resize it now to fit the expected
+   final size instead when that is larger than the regular growth step. */
+static int
+set_bulk_reserve(PySetObject *so, Py_ssize_t seen, Py_ssize_t added,
+                 Py_ssize_t remaining)
+{
+    if ((size_t)(so->fill + 1)*5 < (size_t)so->mask*3) {
+        return 0;
+    }
+    Py_ssize_t expected = _PyDict_EstimateBulkSize(so->used, seen, added,
+                                                   remaining);
+    Py_ssize_t minused = so->used>50000 ? so->used*2 : so->used*4;
+    if (expected*2 <= minused) {
+        return 0;
+    }
+    return set_table_resize(so, expected*2);
+}
+
+static int
+set_update_sequence_lock_held(PySetObject *so, PyObject *seq)
+{
+    _Py_CRITICAL_SECTION_ASSERT_OBJECT_LOCKED(so);
+    assert(PyList_CheckExact(seq) || PyTuple_CheckExact(seq));
+
+    /* The size is re-read on every iteration: comparing keys can run
+       arbitrary code which may mutate a list. */
+    Py_ssize_t start = so->used;
+    for (Py_ssize_t i = 0; i < PySequence_Fast_GET_SIZE(seq); i++) {
+        Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+        if (set_bulk_reserve(so, i, so->used - start, n - i) < 0) {
+            return -1;
+        }
+        if (i + SET_PREFETCH_DISTANCE < n) {
+            set_prefetch_key(so, PySequence_Fast_GET_ITEM(
+                                    seq, i + SET_PREFETCH_DISTANCE));
+        }
+        PyObject *key = Py_NewRef(PySequence_Fast_GET_ITEM(seq, i));
+        int rv = set_add_key(so, key);
+        Py_DECREF(key);
+        if (rv < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
 static int
 set_update_iterable_lock_held(PySetObject *so, PyObject *other)
 {
     _Py_CRITICAL_SECTION_ASSERT_OBJECT_LOCKED(so);
 
+    int sequence = PyTuple_CheckExact(other);
+#ifndef Py_GIL_DISABLED
+    /* In the free-threaded build, the items of a list can only be read
+       safely through its iterator. */
+    sequence = sequence || PyList_CheckExact(other);
+#endif
+    if (sequence) {
+        return set_update_sequence_lock_held(so, other);
+    }
+
     PyObject *it = PyObject_GetIter(other);
     if (it == NULL) {
         return -1;
     }
 
+    /* Guess the number of items. */
+    Py_ssize_t hint = PyObject_LengthHint(other, 0);
+    if (hint < 0) {
+        Py_DECREF(it);
+        return -1;
+    }
+
     PyObject *key;
+    Py_ssize_t seen = 0;
+    Py_ssize_t start = so->used;
     while ((key = PyIter_Next(it)) != NULL) {
+        if (seen < hint
+            && set_bulk_reserve(so, seen, so->used - start, hint - seen) < 0)
+        {
+            Py_DECREF(it);
+            Py_DECREF(key);
+            return -1;
+        }
+        seen++;
         if (set_add_key(so, key)) {
             Py_DECREF(it);
             Py_DECREF(key);
@@ -19,6 +19,52 @@
 /* 10xxxxxx */
 #define IS_CONTINUATION_BYTE(ch) ((ch) >= 0x80 && (ch) < 0xC0)
 
+#if _Py_HAVE_SSE2
+/* Copy the run of ASCII characters at the start of s, checking 16 bytes at
+   a time and widening them to the output kind with unpack instructions.
+   Return the number of characters copied.  Kept out of line so that it
+   does not weigh on register allocation in the decoder loop. */
+static Py_NO_INLINE Py_ssize_t
+STRINGLIB(utf8_decode_ascii)(const char *s, const char *end,
+                             STRINGLIB_CHAR *p)
+{
+    const char *start = s;
+# if STRINGLIB_SIZEOF_CHAR > 1
+    const __m128i zero = _mm_setzero_si128();
+# endif
+    while (end - s >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)s);
+        int mask = _mm_movemask_epi8(v);
+        if (mask) {
+            /* Copy the characters before the first non-ASCII byte:
+               the output may have no room for 16. */
+            unsigned int n = ctz(mask);
+            for (unsigned int k = 0; k < n; k++) {
+                p[k] = (unsigned char)s[k];
+            }
+            s += n;
+            break;
+        }
+# if STRINGLIB_SIZEOF_CHAR == 1
+        _mm_storeu_si128((__m128i *)p, v);
+# elif STRINGLIB_SIZEOF_CHAR == 2
+        _mm_storeu_si128((__m128i *)p, _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128((__m128i *)(p + 8), _mm_unpackhi_epi8(v, zero));
+# else
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_si128((__m128i *)p, _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(p + 4), _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(p + 8), _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128((__m128i *)(p + 12), _mm_unpackhi_epi16(hi, zero));
+# endif
+        s += 16;
+        p += 16;
+    }
+    return s - start;
+}
+#endif
+
 Py_LOCAL_INLINE(Py_UCS4)
 STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                        STRINGLIB_CHAR *dest,
@@ -39,6 +85,16 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                First, check if we can do an aligned read, as most CPUs have
                a penalty for unaligned reads.
             */
+#if _Py_HAVE_SSE2
+            if (_Py_IS_ALIGNED(s, ALIGNOF_SIZE_T)) {
+                Py_ssize_t n = STRINGLIB(utf8_decode_ascii)(s, end, p);
+                s += n;
+                p += n;
+                if (s == end)
+                    break;
+                ch = (unsigned char)*s;
+            }
+#else
             if (_Py_IS_ALIGNED(s, ALIGNOF_SIZE_T)) {
                 /* Help register allocation */
                 const char *_s = s;
@@ -87,6 +143,7 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                     break;
                 ch = (unsigned char)*s;
             }
+#endif
             if (ch < 0x80) {
                 s++;
                 *p++ = ch;
@@ -254,6 +311,52 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
 #undef ASCII_CHAR_MASK
 
 
+#if _Py_HAVE_SSE2
+/* Copy the run of ASCII characters at the start of data, checking 16 at a
+   time and narrowing them to bytes with packs.  The output must have room
+   for 16 bytes, but only the ASCII prefix is kept.  Return the number of
+   characters copied. */
+static Py_NO_INLINE Py_ssize_t
+STRINGLIB(utf8_encode_ascii)(const STRINGLIB_CHAR *data, Py_ssize_t size,
+                             char *p)
+{
+    Py_ssize_t i = 0;
+    while (size - i >= 16) {
+        const __m128i *q = (const __m128i *)(data + i);
+# if STRINGLIB_SIZEOF_CHAR == 1
+        __m128i v = _mm_loadu_si128(q);
+        unsigned int nonascii = _mm_movemask_epi8(v);
+# else
+#  if STRINGLIB_SIZEOF_CHAR == 2
+        __m128i a = _mm_loadu_si128(q);
+        __m128i b = _mm_loadu_si128(q + 1);
+#  else
+        /* Characters above 0x7FFF saturate to 0x7FFF. */
+        __m128i a = _mm_packs_epi32(_mm_loadu_si128(q),
+                                    _mm_loadu_si128(q + 1));
+        __m128i b = _mm_packs_epi32(_mm_loadu_si128(q + 2),
+                                    _mm_loadu_si128(q + 3));
+#  endif
+        /* The packs saturate as signed integers, so find the non-ASCII
+           characters before narrowing them. */
+        const __m128i max_ascii = _mm_set1_epi16(0x7F);
+        const __m128i zero = _mm_setzero_si128();
+        __m128i ascii = _mm_packs_epi16(
+            _mm_cmpeq_epi16(_mm_subs_epu16(a, max_ascii), zero),
+            _mm_cmpeq_epi16(_mm_subs_epu16(b, max_ascii), zero));
+        unsigned int nonascii = ~_mm_movemask_epi8(ascii) & 0xFFFF;
+        __m128i v = _mm_packus_epi16(a, b);
+# endif
+        _mm_storeu_si128((__m128i *)(p + i), v);
+        if (nonascii) {
+            return i + ctz(nonascii);
+        }
+        i += 16;
+    }
+    return i;
+}
+#endif
+
 /* UTF-8 encoder specialized for a Unicode kind to avoid the slow
    PyUnicode_READ() macro. Delete some parts of the code depending on the kind:
    UCS-1 strings don't need to handle surrogates for example. */
@@ -301,7 +404,16 @@ STRINGLIB(utf8_encoder)(PyObject *unicode,
         if (ch < 0x80) {
             /* Encode ASCII */
             *p++ = (char) ch;
-
+#if _Py_HAVE_SSE2
+            /* Leave short runs of ASCII characters, as in text with a
+               non-Latin script, to the main loop. */
+            if (size - i >= 16 && data[i + 2] < 0x80) {
+                Py_ssize_t n = STRINGLIB(utf8_encode_ascii)(data + i,
+                                                            size - i, p);
+                i += n;
+                p += n;
+            }
+#endif
         }
         else
 #if STRINGLIB_SIZEOF_CHAR > 1
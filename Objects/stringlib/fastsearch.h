@@ -2,6 +2,9 @@
 
 #define STRINGLIB_FASTSEARCH_H
 
+#include "pycore_bitutils.h"      // _Py_bit_length()
+#include "pycore_simd.h"          // _Py_HAVE_SSE2
+
 /* fast search/count implementation, based on a mix between boyer-
    moore and horspool, with a few more bells and whistles on the top.
    for some more background, see:
@@ -685,6 +688,116 @@ STRINGLIB(adaptive_find)(const STRINGLIB_CHAR* s, Py_ssize_t n,
     return mode == FAST_COUNT ? count : -1;
 }
 
+#if _Py_HAVE_SSE2
+/* number of candidate positions checked at once */
+#define SIMD_LANES 16
+/* longer needles are better served by the skips of the other searches */
+#define SIMD_MAX_NEEDLE 32
+
+#if STRINGLIB_SIZEOF_CHAR == 1
+#  define SIMD_SET1(ch) _mm_set1_epi8((char)(ch))
+#elif STRINGLIB_SIZEOF_CHAR == 2
+#  define SIMD_SET1(ch) _mm_set1_epi16((short)(ch))
+#else
+#  define SIMD_SET1(ch) _mm_set1_epi32((int)(ch))
+#endif
+
+/* Return a mask of the positions i in [0, SIMD_LANES) where a[i] is the
+   first character of the needle and b[i] the last one. */
+static inline unsigned int
+STRINGLIB(_simd_candidates)(const STRINGLIB_CHAR *a, const STRINGLIB_CHAR *b,
+                            __m128i first, __m128i last)
+{
+#if STRINGLIB_SIZEOF_CHAR == 1
+#  define SIMD_MATCH(k) _mm_and_si128( \
+        _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)a + (k)), first), \
+        _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)b + (k)), last))
+    __m128i match = SIMD_MATCH(0);
+#elif STRINGLIB_SIZEOF_CHAR == 2
+#  define SIMD_MATCH(k) _mm_and_si128( \
+        _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)a + (k)), first), \
+        _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)b + (k)), last))
+    __m128i match = _mm_packs_epi16(SIMD_MATCH(0), SIMD_MATCH(1));
+#else
+#  define SIMD_MATCH(k) _mm_and_si128( \
+        _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)a + (k)), first), \
+        _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)b + (k)), last))
+    __m128i match = _mm_packs_epi16(
+        _mm_packs_epi32(SIMD_MATCH(0), SIMD_MATCH(1)),
+        _mm_packs_epi32(SIMD_MATCH(2), SIMD_MATCH(3)));
+#endif
+#undef SIMD_MATCH
+    return (unsigned int)_mm_movemask_epi8(match);
+}
+
+/* Compare the first and the last characters of the needle with those of
+   SIMD_LANES candidate positions at once, and only compare the rest of the
+   needle where both match.  Like adaptive_find(), fall back to the two-way
+   algorithm if the candidates are mostly false positives. */
+static Py_ssize_t
+STRINGLIB(simd_find)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                     const STRINGLIB_CHAR* p, Py_ssize_t m,
+                     Py_ssize_t maxcount, int mode)
+{
+    const Py_ssize_t w = n - m;
+    const Py_ssize_t mlast = m - 1;
+    const __m128i first = SIMD_SET1(p[0]);
+    const __m128i last = SIMD_SET1(p[mlast]);
+    Py_ssize_t i = 0, count = 0, misses = 0, res;
+
+    while (w - i >= SIMD_LANES - 1) {
+        unsigned int mask = STRINGLIB(_simd_candidates)(s + i, s + i + mlast,
+                                                        first, last);
+        Py_ssize_t next = i + SIMD_LANES;
+        while (mask) {
+            /* index of the lowest set bit */
+            Py_ssize_t k = i + _Py_bit_length(mask & (0U - mask)) - 1;
+            if (memcmp(s + k + 1, p + 1,
+                       (m - 2) * sizeof(STRINGLIB_CHAR)) == 0)
+            {
+                /* got a match! */
+                if (mode != FAST_COUNT) {
+                    return k;
+                }
+                count++;
+                if (count == maxcount) {
+                    return maxcount;
+                }
+                next = k + m;
+                break;
+            }
+            misses += m;
+            mask &= mask - 1;
+        }
+        i = next;
+        /* the partial matches cost more than the scan itself */
+        if (misses > i + 4096 && w - i > 2000) {
+            if (mode == FAST_SEARCH) {
+                res = STRINGLIB(_two_way_find)(s + i, n - i, p, m);
+                return res == -1 ? -1 : res + i;
+            }
+            else {
+                res = STRINGLIB(_two_way_count)(s + i, n - i, p, m,
+                                                maxcount - count);
+                return res + count;
+            }
+        }
+    }
+    if (i <= w) {
+        /* fewer than SIMD_LANES positions left */
+        res = STRINGLIB(default_find)(s + i, n - i, p, m,
+                                      maxcount - count, mode);
+        if (mode == FAST_COUNT) {
+            return res + count;
+        }
+        return res == -1 ? -1 : res + i;
+    }
+    return mode == FAST_COUNT ? count : -1;
+}
+
+#undef SIMD_SET1
+#endif  /* _Py_HAVE_SSE2 */
+
 
 static Py_ssize_t
 STRINGLIB(default_rfind)(const STRINGLIB_CHAR* s, Py_ssize_t n,
@@ -797,6 +910,16 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
     }
 
     if (mode != FAST_RSEARCH) {
+#if _Py_HAVE_SSE2
+        /* Checking SIMD_LANES positions at a time beats the skips of
+           default_find() for the shortest needles, and the two-way
+           algorithm for needles of a few dozen characters. */
+        if (n - m >= SIMD_LANES && m <= SIMD_MAX_NEEDLE
+            && (m < 6 || n >= 30000))
+        {
+            return STRINGLIB(simd_find)(s, n, p, m, maxcount, mode);
+        }
+#endif
         if (n < 2500 || (m < 100 && n < 30000) || m < 6) {
             return STRINGLIB(default_find)(s, n, p, m, maxcount, mode);
         }
@@ -828,3 +951,5 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
     }
 }
 
+#undef SIMD_LANES
+#undef SIMD_MAX_NEEDLE
@@ -55,6 +55,7 @@ OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include "pycore_pyhash.h"        // _Py_HashSecret_t
 #include "pycore_pylifecycle.h"   // _Py_SetFileSystemEncoding()
 #include "pycore_pystate.h"       // _PyInterpreterState_GET()
+#include "pycore_simd.h"          // _Py_HAVE_SSE2
 #include "pycore_ucnhash.h"       // _PyUnicode_Name_CAPI
 #include "pycore_unicodectype.h"  // _PyUnicode_IsXidStart
 #include "pycore_unicodeobject.h" // struct _Py_unicode_state
@@ -4859,6 +4860,30 @@ PyUnicode_DecodeUTF8(const char *s,
     return PyUnicode_DecodeUTF8Stateful(s, size, errors, NULL);
 }
 
+#if (defined(__clang__) || defined(__GNUC__))
+#define HAVE_CTZ 1
+static inline unsigned int
+ctz(size_t v)
+{
+    return __builtin_ctzll((unsigned long long)v);
+}
+#elif defined(_MSC_VER)
+#define HAVE_CTZ 1
+static inline unsigned int
+ctz(size_t v)
+{
+    unsigned long pos;
+#if SIZEOF_SIZE_T == 4
+    _BitScanForward(&pos, v);
+#else
+    _BitScanForward64(&pos, v);
+#endif /* SIZEOF_SIZE_T */
+    return pos;
+}
+#else
+#define HAVE_CTZ 0
+#endif
+
 #include "stringlib/asciilib.h"
 #include "stringlib/codecs.h"
 #include "stringlib/undef.h"
@@ -4890,31 +4915,7 @@ PyUnicode_DecodeUTF8(const char *s,
 # error C 'size_t' size should be either 4 or 8!
 #endif
 
-#if (defined(__clang__) || defined(__GNUC__))
-#define HAVE_CTZ 1
-static inline unsigned int
-ctz(size_t v)
-{
-    return __builtin_ctzll((unsigned long long)v);
-}
-#elif defined(_MSC_VER)
-#define HAVE_CTZ 1
-static inline unsigned int
-ctz(size_t v)
-{
-    unsigned long pos;
-#if SIZEOF_SIZE_T == 4
-    _BitScanForward(&pos, v);
-#else
-    _BitScanForward64(&pos, v);
-#endif /* SIZEOF_SIZE_T */
-    return pos;
-}
-#else
-#define HAVE_CTZ 0
-#endif
-
-#if HAVE_CTZ && PY_LITTLE_ENDIAN
+#if HAVE_CTZ && PY_LITTLE_ENDIAN && !_Py_HAVE_SSE2
 // load p[0]..p[size-1] as a size_t without unaligned access nor read ahead.
 static size_t
 load_unaligned(const unsigned char *p, size_t size)
@@ -4970,6 +4971,45 @@ load_unaligned(const unsigned char *p, size_t size)
  * significant bit set). If all characters in the range are ASCII, it returns
  * `end - start`.
  */
+#if _Py_HAVE_SSE2
+static Py_ssize_t
+find_first_nonascii(const unsigned char *start, const unsigned char *end)
+{
+    const unsigned char *p = start;
+
+    if (end - p < 16) {
+        while (p < end && !(*p & 0x80)) {
+            p++;
+        }
+        return p - start;
+    }
+    while (end - p >= 32) {
+        __m128i a = _mm_loadu_si128((const __m128i *)p);
+        __m128i b = _mm_loadu_si128((const __m128i *)(p + 16));
+        if (_mm_movemask_epi8(_mm_or_si128(a, b))) {
+            break;
+        }
+        p += 32;
+    }
+    while (end - p >= 16) {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)p));
+        if (mask) {
+            return p - start + ctz(mask);
+        }
+        p += 16;
+    }
+    if (p < end) {
+        // Check the remaining bytes with the last 16 bytes of the input:
+        // those before p are already known to be ASCII.
+        p = end - 16;
+        int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)p));
+        if (mask) {
+            return p - start + ctz(mask);
+        }
+    }
+    return end - start;
+}
+#else
 static Py_ssize_t
 find_first_nonascii(const unsigned char *start, const unsigned char *end)
 {
@@ -5032,6 +5072,7 @@ find_first_nonascii(const unsigned char *start, const unsigned char *end)
     return p - start;
 #endif
 }
+#endif  /* _Py_HAVE_SSE2 */
 
 static inline int
 scalar_utf8_start_char(unsigned int ch)
@@ -5047,17 +5088,71 @@ vector_utf8_start_chars(size_t v)
 }
 
 
-// Count the number of UTF-8 code points in a given byte sequence.
-static Py_ssize_t
-utf8_count_codepoints(const unsigned char *s, const unsigned char *end)
+// Return the maximum character of valid UTF-8 data from its largest byte:
+// lead bytes from 0xC4 start characters from U+0100, and lead bytes from 0xF0
+// characters from U+10000.  Continuation bytes are at most 0xBF.
+static inline Py_UCS4
+utf8_maxchar_from_byte(unsigned char maxbyte)
 {
-    Py_ssize_t len = 0;
+    if (maxbyte >= 0xF0) {
+        return 0x10ffff;
+    }
+    if (maxbyte >= 0xC4) {
+        return 0xffff;
+    }
+    return 0xff;
+}
 
+// Count the number of UTF-8 code points in a given byte sequence, and find
+// the maximum character it decodes to, if it is valid UTF-8.
+// *maxchar is set to 0xff, 0xffff or 0x10ffff.  Not inlined, so as not to
+// slow down the decoder loop of the caller.
+static Py_NO_INLINE Py_ssize_t
+utf8_count_codepoints(const unsigned char *s, const unsigned char *end,
+                      Py_UCS4 *maxchar)
+{
+    Py_ssize_t len = 0;
+    unsigned char maxbyte = 0;
+
+#if _Py_HAVE_SSE2
+    if (end - s >= 16) {
+        // Bytes greater than -65 as signed chars are first bytes.
+        const __m128i first_min = _mm_set1_epi8(-65);
+        __m128i vmax = _mm_setzero_si128();
+        while (end - s >= 16) {
+            // Count in 8-bit lanes for at most 255 iterations.
+            const unsigned char *e = end;
+            if (e - s > 16 * 255) {
+                e = s + 16 * 255;
+            }
+            __m128i vstart = _mm_setzero_si128();
+            while (e - s >= 16) {
+                __m128i v = _mm_loadu_si128((const __m128i *)s);
+                vmax = _mm_max_epu8(vmax, v);
+                vstart = _mm_sub_epi8(vstart, _mm_cmpgt_epi8(v, first_min));
+                s += 16;
+            }
+            __m128i sums = _mm_sad_epu8(vstart, _mm_setzero_si128());
+            len += _mm_cvtsi128_si32(sums)
+                   + _mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+        }
+        vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 8));
+        vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 4));
+        vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 2));
+        vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 1));
+        maxbyte = (unsigned char)_mm_cvtsi128_si32(vmax);
+    }
+#else
     if (end - s >= SIZEOF_SIZE_T) {
         while (!_Py_IS_ALIGNED(s, ALIGNOF_SIZE_T)) {
+            maxbyte = Py_MAX(maxbyte, *s);
             len += scalar_utf8_start_char(*s++);
         }
 
+        // The top bit of each byte of `ucs2` is set for bytes from 0xC4
+        // (11xxxxxx with one of the next four bits set), and that of `ucs4`
+        // for bytes from 0xF0 (1111xxxx).
+        size_t ucs2 = 0, ucs4 = 0;
         while (s + SIZEOF_SIZE_T <= end) {
             const unsigned char *e = end;
             if (e - s > SIZEOF_SIZE_T * 255) {
@@ -5068,6 +5163,8 @@ utf8_count_codepoints(const unsigned char *s, const unsigned char *end)
                 size_t v = *(size_t*)s;
                 size_t vs = vector_utf8_start_chars(v);
                 vstart += vs;
+                ucs2 |= v & (v << 1) & ((v << 2) | (v << 3) | (v << 4) | (v << 5));
+                ucs4 |= v & (v << 1) & (v << 2) & (v << 3);
                 s += SIZEOF_SIZE_T;
             }
             vstart = (vstart & VECTOR_00FF) + ((vstart >> 8) & VECTOR_00FF);
@@ -5077,16 +5174,42 @@ utf8_count_codepoints(const unsigned char *s, const unsigned char *end)
 #endif
             len += vstart & 0x7ff;
         }
+        if (ucs4 & ASCII_CHAR_MASK) {
+            maxbyte = 0xF0;
+        }
+        else if ((ucs2 & ASCII_CHAR_MASK) && maxbyte < 0xC4) {
+            maxbyte = 0xC4;
+        }
     }
+#endif
     while (s < end) {
+        maxbyte = Py_MAX(maxbyte, *s);
         len += scalar_utf8_start_char(*s++);
     }
+    *maxchar = utf8_maxchar_from_byte(maxbyte);
     return len;
 }
 
 static Py_ssize_t
 ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
 {
+#if _Py_HAVE_SSE2
+    const char *p = start;
+    Py_UCS1 *q = dest;
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        if (_mm_movemask_epi8(v)) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)q, v);
+        p += 16;
+        q += 16;
+    }
+    while (p < end && !((unsigned char)*p & 0x80)) {
+        *q++ = *p++;
+    }
+    return p - start;
+#else
 #if SIZEOF_SIZE_T <= SIZEOF_VOID_P
     if (_Py_IS_ALIGNED(start, ALIGNOF_SIZE_T)
         && _Py_IS_ALIGNED(dest, ALIGNOF_SIZE_T))
@@ -5115,6 +5238,7 @@ ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
                                          (const unsigned char*)end);
     memcpy(dest, start, pos);
     return pos;
+#endif  /* _Py_HAVE_SSE2 */
 }
 
 static int
@@ -5283,7 +5407,7 @@ unicode_decode_utf8(const char *s, Py_ssize_t size,
         return u;
     }
 
-    int maxchr = 127;
+    Py_UCS4 maxchr = 127;
     Py_ssize_t maxsize = size;
 
     unsigned char ch = (unsigned char)(s[pos]);
@@ -5293,21 +5417,13 @@ unicode_decode_utf8(const char *s, Py_ssize_t size,
     // otherwise: check the input and decide the maxchr and maxsize to reduce
     // reallocation and copy.
     if (error_handler == _Py_ERROR_STRICT && !consumed && ch >= 0xc2) {
-        // we only calculate the number of codepoints and don't determine the exact maxchr.
-        // This is because writing fast and portable SIMD code to find maxchr is difficult.
-        // If reallocation occurs for a larger maxchar, knowing the exact number of codepoints
-        // means that it is no longer necessary to allocate several times the required amount
-        // of memory.
-        maxsize = utf8_count_codepoints((const unsigned char *)s, (const unsigned char *)end);
-        if (ch < 0xc4) { // latin1
-            maxchr = 0xff;
-        }
-        else if (ch < 0xf0) { // ucs2
-            maxchr = 0xffff;
-        }
-        else { // ucs4
-            maxchr = 0x10ffff;
-        }
+        // Count the codepoints and find the maxchar of the rest of the
+        // input in one pass, so that the string is created with its final
+        // size and kind and never needs to be reallocated or widened.
+        // The first pos bytes are ASCII.
+        maxsize = pos + utf8_count_codepoints((const unsigned char *)s + pos,
+                                              (const unsigned char *)end,
+                                              &maxchr);
     }
     PyObject *u = PyUnicode_New(maxsize, maxchr);
     if (!u) {
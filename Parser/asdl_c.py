@@ -738,7 +738,7 @@ def emit_sequence_constructor(self, name, type):
 class PyTypesDeclareVisitor(PickleVisitor):
 
     def visitProduct(self, prod, name):
-        self.emit("static PyObject* ast2obj_%s(struct ast_state *state, void*);" % name, 0)
+        self.emit("static PyObject* ast2obj_%s(struct ast_state *state, PyObject *lazy, void*);" % name, 0)
         if prod.attributes:
             self.emit("static const char * const %s_attributes[] = {" % name, 0)
             for a in prod.attributes:
@@ -759,7 +759,7 @@ def visitSum(self, sum, name):
         ptype = "void*"
         if is_simple(sum):
             ptype = get_c_type(name)
-        self.emit("static PyObject* ast2obj_%s(struct ast_state *state, %s);" % (name, ptype), 0)
+        self.emit("static PyObject* ast2obj_%s(struct ast_state *state, PyObject *lazy, %s);" % (name, ptype), 0)
         for t in sum.types:
             self.visitConstructor(t, name)
 
@@ -840,8 +840,60 @@ def visitModule(self, mod):
 typedef struct {
     PyObject_HEAD
     PyObject *dict;
+    /* Set for the nodes of a lazy AST (see PyAST_mod2obj_lazy()) until
+       their fields are converted: the C node and the object which keeps
+       its arena alive. */
+    void *lazy_node;
+    PyObject *lazy_owner;
 } AST_object;
 
+static int ast2obj_lazy_fields(struct ast_state *state, PyObject *lazy,
+                               PyObject *result, void *node);
+
+/* Convert the fields of a node of a lazy AST, if not done yet.  Its
+   children are created lazily in turn. */
+static int
+ast_materialize(AST_object *self)
+{
+    if (FT_ATOMIC_LOAD_PTR_ACQUIRE(self->lazy_node) == NULL) {
+        return 0;
+    }
+    struct ast_state *state = get_ast_state();
+    if (state == NULL) {
+        return -1;
+    }
+    int res = 0;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    if (self->lazy_node != NULL) {
+        res = ast2obj_lazy_fields(state, self->lazy_owner, (PyObject *)self,
+                                  self->lazy_node);
+        if (res == 0) {
+            FT_ATOMIC_STORE_PTR_RELEASE(self->lazy_node, NULL);
+            Py_CLEAR(self->lazy_owner);
+        }
+    }
+    Py_END_CRITICAL_SECTION();
+    return res;
+}
+
+static PyObject *
+ast_getattro(PyObject *op, PyObject *name)
+{
+    if (ast_materialize((AST_object*)op) < 0) {
+        return NULL;
+    }
+    return PyObject_GenericGetAttr(op, name);
+}
+
+static int
+ast_setattro(PyObject *op, PyObject *name, PyObject *value)
+{
+    if (ast_materialize((AST_object*)op) < 0) {
+        return -1;
+    }
+    return PyObject_GenericSetAttr(op, name, value);
+}
+
 static void
 ast_dealloc(PyObject *op)
 {
@@ -850,6 +902,7 @@ def visitModule(self, mod):
     PyTypeObject *tp = Py_TYPE(self);
     PyObject_GC_UnTrack(self);
     Py_CLEAR(self->dict);
+    Py_CLEAR(self->lazy_owner);
     freefunc free_func = PyType_GetSlot(tp, Py_tp_free);
     assert(free_func != NULL);
     free_func(self);
@@ -862,6 +915,7 @@ def visitModule(self, mod):
     AST_object *self = (AST_object*)op;
     Py_VISIT(Py_TYPE(self));
     Py_VISIT(self->dict);
+    Py_VISIT(self->lazy_owner);
     return 0;
 }
 
@@ -870,6 +924,8 @@ def visitModule(self, mod):
 {
     AST_object *self = (AST_object*)op;
     Py_CLEAR(self->dict);
+    self->lazy_node = NULL;
+    Py_CLEAR(self->lazy_owner);
     return 0;
 }
 
@@ -1689,8 +1745,8 @@ def visitModule(self, mod):
 static PyType_Slot AST_type_slots[] = {
     {Py_tp_dealloc, ast_dealloc},
     {Py_tp_repr, ast_repr},
-    {Py_tp_getattro, PyObject_GenericGetAttr},
-    {Py_tp_setattro, PyObject_GenericSetAttr},
+    {Py_tp_getattro, ast_getattro},
+    {Py_tp_setattro, ast_setattro},
     {Py_tp_traverse, ast_traverse},
     {Py_tp_clear, ast_clear},
     {Py_tp_members, ast_type_members},
@@ -1760,8 +1816,42 @@ def visitModule(self, mod):
 
 /* Conversion AST -> Python */
 
-static PyObject* ast2obj_list(struct ast_state *state, asdl_seq *seq,
-                              PyObject* (*func)(struct ast_state *state, void*))
+typedef int (*ast2obj_fields_func)(struct ast_state *state, PyObject *lazy,
+                                   PyObject *result, void *node);
+
+/* Create a node of type tp for the C node.  If lazy is NULL, its fields
+   are converted right away by fill.  Otherwise they are converted on first
+   access, and lazy is the object which owns the arena of the C AST. */
+static PyObject* ast2obj_node(struct ast_state *state, PyObject *lazy,
+                              PyObject *tp, void *node,
+                              ast2obj_fields_func fill)
+{
+    PyObject *result = PyType_GenericNew((PyTypeObject *)tp, NULL, NULL);
+    if (!result) {
+        return NULL;
+    }
+    if (lazy != NULL) {
+        ((AST_object *)result)->lazy_node = node;
+        ((AST_object *)result)->lazy_owner = Py_NewRef(lazy);
+        return result;
+    }
+    if (Py_EnterRecursiveCall("during  ast construction")) {
+        Py_DECREF(result);
+        return NULL;
+    }
+    int res = fill(state, NULL, result, node);
+    Py_LeaveRecursiveCall();
+    if (res < 0) {
+        Py_DECREF(result);
+        return NULL;
+    }
+    return result;
+}
+
+static PyObject* ast2obj_list(struct ast_state *state, PyObject *lazy,
+                              asdl_seq *seq,
+                              PyObject* (*func)(struct ast_state *state,
+                                                PyObject *lazy, void*))
 {
     Py_ssize_t i, n = asdl_seq_LEN(seq);
     PyObject *result = PyList_New(n);
@@ -1769,7 +1859,7 @@ def visitModule(self, mod):
     if (!result)
         return NULL;
     for (i = 0; i < n; i++) {
-        value = func(state, asdl_seq_GET_UNTYPED(seq, i));
+        value = func(state, lazy, asdl_seq_GET_UNTYPED(seq, i));
         if (!value) {
             Py_DECREF(result);
             return NULL;
@@ -1779,7 +1869,8 @@ def visitModule(self, mod):
     return result;
 }
 
-static PyObject* ast2obj_object(struct ast_state *Py_UNUSED(state), void *o)
+static PyObject* ast2obj_object(struct ast_state *Py_UNUSED(state),
+                                PyObject *Py_UNUSED(lazy), void *o)
 {
     PyObject *op = (PyObject*)o;
     if (!op) {
@@ -1791,7 +1882,8 @@ def visitModule(self, mod):
 #define ast2obj_identifier ast2obj_object
 #define ast2obj_string ast2obj_object
 
-static PyObject* ast2obj_int(struct ast_state *Py_UNUSED(state), long b)
+static PyObject* ast2obj_int(struct ast_state *Py_UNUSED(state),
+                             PyObject *Py_UNUSED(lazy), long b)
 {
     return PyLong_FromLong(b);
 }
@@ -1982,6 +2074,9 @@ def visitModule(self, mod):
         self.emit('if (PyModule_AddIntMacro(m, PyCF_OPTIMIZED_AST) < 0) {', 1)
         self.emit("return -1;", 2)
         self.emit('}', 1)
+        self.emit('if (PyModule_AddIntMacro(m, PyCF_LAZY_AST) < 0) {', 1)
+        self.emit("return -1;", 2)
+        self.emit('}', 1)
         for dfn in mod.dfns:
             self.visit(dfn)
         self.emit("return 0;", 1)
@@ -2037,29 +2132,58 @@ def visit(self, object):
 
 class ObjVisitor(PickleVisitor):
 
+    def visitModule(self, mod):
+        self.lazy_types = []
+        super().visitModule(mod)
+        # A node of a lazy AST is always an instance of a constructor of a
+        # sum type or of a product type, created by ast2obj_node().
+        self.emit("static int", 0)
+        self.emit("ast2obj_lazy_fields(struct ast_state *state, PyObject *lazy,", 0)
+        self.emit("                    PyObject *result, void *node)", 0, reflow=False)
+        self.emit("{", 0)
+        self.emit("PyObject *tp = (PyObject *)Py_TYPE(result);", 1)
+        self.emit("PyObject *base = (PyObject *)Py_TYPE(result)->tp_base;", 1)
+        for name, is_product in self.lazy_types:
+            type = "tp" if is_product else "base"
+            self.emit("if (%s == state->%s_type) {" % (type, name), 1)
+            self.emit("return ast2obj_%s_fields(state, lazy, result, node);" % name, 2)
+            self.emit("}", 1)
+        self.emit("Py_UNREACHABLE();", 1)
+        self.emit("}", 0)
+        self.emit("", 0)
+
+    def fields_func_begin(self, name):
+        ctype = get_c_type(name)
+        self.emit("static int", 0)
+        self.emit("ast2obj_%s_fields(struct ast_state *state, PyObject *lazy,"
+                  % name, 0)
+        indent = " " * len("ast2obj_%s_fields(" % name)
+        self.emit(indent + "PyObject *result, void* _o)", 0, reflow=False)
+        self.emit("{", 0)
+        self.emit("%s o = (%s)_o;" % (ctype, ctype), 1)
+        self.emit("PyObject *value = NULL;", 1)
+
+    def fields_func_end(self):
+        self.emit("return 0;", 1)
+        self.emit("failed:", 0)
+        self.emit("Py_XDECREF(value);", 1)
+        self.emit("return -1;", 1)
+        self.emit("}", 0)
+        self.emit("", 0)
+
     def func_begin(self, name):
         ctype = get_c_type(name)
         self.emit("PyObject*", 0)
-        self.emit("ast2obj_%s(struct ast_state *state, void* _o)" % (name), 0)
+        self.emit("ast2obj_%s(struct ast_state *state, PyObject *lazy, void* _o)" % (name), 0)
         self.emit("{", 0)
         self.emit("%s o = (%s)_o;" % (ctype, ctype), 1)
-        self.emit("PyObject *result = NULL, *value = NULL;", 1)
-        self.emit("PyTypeObject *tp;", 1)
         self.emit('if (!o) {', 1)
         self.emit("Py_RETURN_NONE;", 2)
         self.emit("}", 1)
-        self.emit('if (Py_EnterRecursiveCall("during  ast construction")) {', 1)
-        self.emit("return NULL;", 2)
-        self.emit("}", 1)
 
-    def func_end(self):
-        self.emit("Py_LeaveRecursiveCall();", 1)
-        self.emit("return result;", 1)
-        self.emit("failed:", 0)
-        self.emit("Py_LeaveRecursiveCall();", 1)
-        self.emit("Py_XDECREF(value);", 1)
-        self.emit("Py_XDECREF(result);", 1)
-        self.emit("return NULL;", 1)
+    def func_end(self, name, tp):
+        self.emit("return ast2obj_node(state, lazy, %s, o, ast2obj_%s_fields);"
+                  % (tp, name), 1)
         self.emit("}", 0)
         self.emit("", 0)
 
@@ -2067,22 +2191,35 @@ def visitSum(self, sum, name):
         if is_simple(sum):
             self.simpleSum(sum, name)
             return
-        self.func_begin(name)
+        self.lazy_types.append((name, False))
+        self.fields_func_begin(name)
         self.emit("switch (o->kind) {", 1)
-        for i in range(len(sum.types)):
-            t = sum.types[i]
-            self.visitConstructor(t, i + 1, name)
+        for t in sum.types:
+            self.visitConstructor(t, name)
         self.emit("}", 1)
         for a in sum.attributes:
-            self.emit("value = ast2obj_%s(state, o->%s);" % (a.type, a.name), 1)
+            self.emit("value = ast2obj_%s(state, lazy, o->%s);" % (a.type, a.name), 1)
             self.emit("if (!value) goto failed;", 1)
-            self.emit('if (PyObject_SetAttr(result, state->%s, value) < 0)' % a.name, 1)
+            self.emit('if (PyObject_GenericSetAttr(result, state->%s, value) < 0)' % a.name, 1)
             self.emit('goto failed;', 2)
             self.emit('Py_DECREF(value);', 1)
-        self.func_end()
+        self.fields_func_end()
+
+        self.func_begin(name)
+        self.emit("PyObject *tp;", 1)
+        self.emit("switch (o->kind) {", 1)
+        for t in sum.types:
+            self.emit("case %s_kind:" % t.name, 1)
+            self.emit("tp = state->%s_type;" % t.name, 2)
+            self.emit("break;", 2)
+        self.emit("default:", 1)
+        self.emit("Py_UNREACHABLE();", 2)
+        self.emit("}", 1)
+        self.func_end(name, "tp")
 
     def simpleSum(self, sum, name):
-        self.emit("PyObject* ast2obj_%s(struct ast_state *state, %s_ty o)" % (name, name), 0)
+        self.emit("PyObject* ast2obj_%s(struct ast_state *state, "
+                  "PyObject *Py_UNUSED(lazy), %s_ty o)" % (name, name), 0)
         self.emit("{", 0)
         self.emit("switch(o) {", 1)
         for t in sum.types:
@@ -2093,25 +2230,23 @@ def simpleSum(self, sum, name):
         self.emit("}", 0)
 
     def visitProduct(self, prod, name):
-        self.func_begin(name)
-        self.emit("tp = (PyTypeObject *)state->%s_type;" % name, 1)
-        self.emit("result = PyType_GenericNew(tp, NULL, NULL);", 1);
-        self.emit("if (!result) return NULL;", 1)
+        self.lazy_types.append((name, True))
+        self.fields_func_begin(name)
         for field in prod.fields:
             self.visitField(field, name, 1, True)
         for a in prod.attributes:
-            self.emit("value = ast2obj_%s(state, o->%s);" % (a.type, a.name), 1)
+            self.emit("value = ast2obj_%s(state, lazy, o->%s);" % (a.type, a.name), 1)
             self.emit("if (!value) goto failed;", 1)
-            self.emit("if (PyObject_SetAttr(result, state->%s, value) < 0)" % a.name, 1)
+            self.emit("if (PyObject_GenericSetAttr(result, state->%s, value) < 0)" % a.name, 1)
             self.emit('goto failed;', 2)
             self.emit('Py_DECREF(value);', 1)
-        self.func_end()
+        self.fields_func_end()
 
-    def visitConstructor(self, cons, enum, name):
+        self.func_begin(name)
+        self.func_end(name, "state->%s_type" % name)
+
+    def visitConstructor(self, cons, name):
         self.emit("case %s_kind:" % cons.name, 1)
-        self.emit("tp = (PyTypeObject *)state->%s_type;" % cons.name, 2)
-        self.emit("result = PyType_GenericNew(tp, NULL, NULL);", 2);
-        self.emit("if (!result) goto failed;", 2)
         for f in cons.fields:
             self.visitField(f, cons.name, 2, False)
         self.emit("break;", 2)
@@ -2125,7 +2260,7 @@ def emit(s, d):
             value = "o->v.%s.%s" % (name, field.name)
         self.set(field, value, depth)
         emit("if (!value) goto failed;", 0)
-        emit("if (PyObject_SetAttr(result, state->%s, value) == -1)" % field.name, 0)
+        emit("if (PyObject_GenericSetAttr(result, state->%s, value) == -1)" % field.name, 0)
         emit("goto failed;", 1)
         emit("Py_DECREF(value);", 0)
 
@@ -2141,7 +2276,7 @@ def set(self, field, value, depth):
                 self.emit("for(i = 0; i < n; i++)", depth+1)
                 # This cannot fail, so no need for error handling
                 self.emit(
-                    "PyList_SET_ITEM(value, i, ast2obj_{0}(state, ({0}_ty)asdl_seq_GET({1}, i)));".format(
+                    "PyList_SET_ITEM(value, i, ast2obj_{0}(state, lazy, ({0}_ty)asdl_seq_GET({1}, i)));".format(
                         field.type,
                         value
                     ),
@@ -2150,9 +2285,9 @@ def set(self, field, value, depth):
                 )
                 self.emit("}", depth)
             else:
-                self.emit("value = ast2obj_list(state, (asdl_seq*)%s, ast2obj_%s);" % (value, field.type), depth)
+                self.emit("value = ast2obj_list(state, lazy, (asdl_seq*)%s, ast2obj_%s);" % (value, field.type), depth)
         else:
-            self.emit("value = ast2obj_%s(state, %s);" % (field.type, value), depth, reflow=False)
+            self.emit("value = ast2obj_%s(state, lazy, %s);" % (field.type, value), depth, reflow=False)
 
 
 class PartingShots(StaticVisitor):
@@ -2164,8 +2299,33 @@ class PartingShots(StaticVisitor):
     if (state == NULL) {
         return NULL;
     }
-    PyObject *result = ast2obj_mod(state, t);
+    PyObject *result = ast2obj_mod(state, NULL, t);
+
+    return result;
+}
 
+static void
+ast_arena_destructor(PyObject *capsule)
+{
+    _PyArena_Free(PyCapsule_GetPointer(capsule, NULL));
+}
+
+/* Like PyAST_mod2obj(), but the fields of each node are converted on first
+   access.  Take ownership of arena, which is freed once no node needs it. */
+PyObject* PyAST_mod2obj_lazy(mod_ty t, PyArena *arena)
+{
+    struct ast_state *state = get_ast_state();
+    if (state == NULL) {
+        _PyArena_Free(arena);
+        return NULL;
+    }
+    PyObject *owner = PyCapsule_New(arena, NULL, ast_arena_destructor);
+    if (owner == NULL) {
+        _PyArena_Free(arena);
+        return NULL;
+    }
+    PyObject *result = ast2obj_mod(state, owner, t);
+    Py_DECREF(owner);
     return result;
 }
 
@@ -2302,6 +2462,8 @@ def generate_module_def(mod, metadata, f, internal_h):
         #include "pycore_ceval.h"         // _Py_EnterRecursiveCall()
         #include "pycore_lock.h"          // _PyOnceFlag
         #include "pycore_modsupport.h"    // _PyArg_NoPositional()
+        #include "pycore_pyarena.h"       // _PyArena_Free()
+        #include "pycore_pyatomic_ft_wrappers.h" // FT_ATOMIC_LOAD_PTR_ACQUIRE()
         #include "pycore_pystate.h"       // _PyInterpreterState_GET()
         #include "pycore_runtime.h"       // _Py_ID()
         #include "pycore_setobject.h"     // _PySet_NextEntry()
@@ -2368,6 +2530,7 @@ def write_header(mod, metadata, f):
     f.write(textwrap.dedent("""
 
         PyObject* PyAST_mod2obj(mod_ty t);
+        PyObject* PyAST_mod2obj_lazy(mod_ty t, PyArena *arena);
         int PyAst_CheckMode(PyObject *ast, int mode);
         mod_ty PyAST_obj2mod(PyObject* ast, PyArena* arena, int mode);
         int PyAST_Check(PyObject* obj);
@@ -110,6 +110,54 @@ tok_backup(struct tok_state *tok, int c)
     }
 }
 
+/* Skip the characters of the current buffer up to (not including) end, as
+   calls of tok_nextc() would do.  This is used for runs of characters which
+   need no special handling; the caller resumes with tok_nextc(), which also
+   reads the next line at the end of the buffer. */
+static inline void
+tok_skip(struct tok_state *tok, const char *end)
+{
+    assert(tok->cur <= end && end <= tok->inp);
+    Py_ssize_t n = end - tok->cur;
+    if (n > 0 && n < INT_MAX - tok->col_offset) {
+        tok->cur += n;
+        tok->col_offset += (int)n;
+    }
+}
+
+/* Return the end of the run of ASCII identifier characters starting at p. */
+static inline const char *
+scan_ascii_identifier(const char *p, const char *end)
+{
+    while (p < end && (Py_ISALNUM(*p) || *p == '_')) {
+        p++;
+    }
+    return p;
+}
+
+/* Return the position of the first '\n' or '\r' at or after p, or end. */
+static inline const char *
+scan_line_end(const char *p, const char *end)
+{
+    const char *nl = memchr(p, '\n', end - p);
+    if (nl != NULL) {
+        end = nl;
+    }
+    const char *cr = memchr(p, '\r', end - p);
+    return cr != NULL ? cr : end;
+}
+
+/* Return the position of the first character at or after p which may end
+   or escape a string body quoted by quote, or end. */
+static inline const char *
+scan_string_body(const char *p, const char *end, char quote)
+{
+    while (p < end && *p != quote && *p != '\\' && *p != '\n') {
+        p++;
+    }
+    return p;
+}
+
 static int
 set_ftstring_expr(struct tok_state* tok, struct token *token, char c) {
     assert(token != NULL);
@@ -656,6 +704,7 @@ tok_get_normal_mode(struct tok_state *tok, tokenizer_mode* current_tok, struct t
         int current_starting_col_offset;
 
         while (c != EOF && c != '\n' && c != '\r') {
+            tok_skip(tok, scan_line_end(tok->cur, tok->inp));
             c = tok_nextc(tok);
         }
 
@@ -785,6 +834,7 @@ tok_get_normal_mode(struct tok_state *tok, tokenizer_mode* current_tok, struct t
             if (c >= 128) {
                 nonascii = 1;
             }
+            tok_skip(tok, scan_ascii_identifier(tok->cur, tok->inp));
             c = tok_nextc(tok);
         }
         tok_backup(tok, c);
@@ -1160,6 +1210,9 @@ tok_get_normal_mode(struct tok_state *tok, tokenizer_mode* current_tok, struct t
 
         /* Get rest of string */
         while (end_quote_size != quote_size) {
+            if (end_quote_size == 0) {
+                tok_skip(tok, scan_string_body(tok->cur, tok->inp, quote));
+            }
             c = tok_nextc(tok);
             if (tok->done == E_ERROR) {
                 return MAKE_TOKEN(ERRORTOKEN);
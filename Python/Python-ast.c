@@ -6,6 +6,8 @@
 #include "pycore_ceval.h"         // _Py_EnterRecursiveCall()
 #include "pycore_lock.h"          // _PyOnceFlag
 #include "pycore_modsupport.h"    // _PyArg_NoPositional()
+#include "pycore_pyarena.h"       // _PyArena_Free()
+#include "pycore_pyatomic_ft_wrappers.h" // FT_ATOMIC_LOAD_PTR_ACQUIRE()
 #include "pycore_pystate.h"       // _PyInterpreterState_GET()
 #include "pycore_runtime.h"       // _Py_ID()
 #include "pycore_setobject.h"     // _PySet_NextEntry()
@@ -392,7 +394,7 @@ GENERATE_ASDL_SEQ_CONSTRUCTOR(pattern, pattern_ty)
 GENERATE_ASDL_SEQ_CONSTRUCTOR(type_ignore, type_ignore_ty)
 GENERATE_ASDL_SEQ_CONSTRUCTOR(type_param, type_param_ty)
 
-static PyObject* ast2obj_mod(struct ast_state *state, void*);
+static PyObject* ast2obj_mod(struct ast_state *state, PyObject *lazy, void*);
 static const char * const Module_fields[]={
     "body",
     "type_ignores",
@@ -413,7 +415,7 @@ static const char * const stmt_attributes[] = {
     "end_lineno",
     "end_col_offset",
 };
-static PyObject* ast2obj_stmt(struct ast_state *state, void*);
+static PyObject* ast2obj_stmt(struct ast_state *state, PyObject *lazy, void*);
 static const char * const FunctionDef_fields[]={
     "name",
     "args",
@@ -548,7 +550,7 @@ static const char * const expr_attributes[] = {
     "end_lineno",
     "end_col_offset",
 };
-static PyObject* ast2obj_expr(struct ast_state *state, void*);
+static PyObject* ast2obj_expr(struct ast_state *state, PyObject *lazy, void*);
 static const char * const BoolOp_fields[]={
     "op",
     "values",
@@ -670,12 +672,18 @@ static const char * const Slice_fields[]={
     "upper",
     "step",
 };
-static PyObject* ast2obj_expr_context(struct ast_state *state, expr_context_ty);
-static PyObject* ast2obj_boolop(struct ast_state *state, boolop_ty);
-static PyObject* ast2obj_operator(struct ast_state *state, operator_ty);
-static PyObject* ast2obj_unaryop(struct ast_state *state, unaryop_ty);
-static PyObject* ast2obj_cmpop(struct ast_state *state, cmpop_ty);
-static PyObject* ast2obj_comprehension(struct ast_state *state, void*);
+static PyObject* ast2obj_expr_context(struct ast_state *state, PyObject *lazy,
+                                      expr_context_ty);
+static PyObject* ast2obj_boolop(struct ast_state *state, PyObject *lazy,
+                                boolop_ty);
+static PyObject* ast2obj_operator(struct ast_state *state, PyObject *lazy,
+                                  operator_ty);
+static PyObject* ast2obj_unaryop(struct ast_state *state, PyObject *lazy,
+                                 unaryop_ty);
+static PyObject* ast2obj_cmpop(struct ast_state *state, PyObject *lazy,
+                               cmpop_ty);
+static PyObject* ast2obj_comprehension(struct ast_state *state, PyObject *lazy,
+                                       void*);
 static const char * const comprehension_fields[]={
     "target",
     "iter",
@@ -688,13 +696,15 @@ static const char * const excepthandler_attributes[] = {
     "end_lineno",
     "end_col_offset",
 };
-static PyObject* ast2obj_excepthandler(struct ast_state *state, void*);
+static PyObject* ast2obj_excepthandler(struct ast_state *state, PyObject *lazy,
+                                       void*);
 static const char * const ExceptHandler_fields[]={
     "type",
     "name",
     "body",
 };
-static PyObject* ast2obj_arguments(struct ast_state *state, void*);
+static PyObject* ast2obj_arguments(struct ast_state *state, PyObject *lazy,
+                                   void*);
 static const char * const arguments_fields[]={
     "posonlyargs",
     "args",
@@ -704,7 +714,7 @@ static const char * const arguments_fields[]={
     "kwarg",
     "defaults",
 };
-static PyObject* ast2obj_arg(struct ast_state *state, void*);
+static PyObject* ast2obj_arg(struct ast_state *state, PyObject *lazy, void*);
 static const char * const arg_attributes[] = {
     "lineno",
     "col_offset",
@@ -716,7 +726,8 @@ static const char * const arg_fields[]={
     "annotation",
     "type_comment",
 };
-static PyObject* ast2obj_keyword(struct ast_state *state, void*);
+static PyObject* ast2obj_keyword(struct ast_state *state, PyObject *lazy,
+                                 void*);
 static const char * const keyword_attributes[] = {
     "lineno",
     "col_offset",
@@ -727,7 +738,7 @@ static const char * const keyword_fields[]={
     "arg",
     "value",
 };
-static PyObject* ast2obj_alias(struct ast_state *state, void*);
+static PyObject* ast2obj_alias(struct ast_state *state, PyObject *lazy, void*);
 static const char * const alias_attributes[] = {
     "lineno",
     "col_offset",
@@ -738,12 +749,14 @@ static const char * const alias_fields[]={
     "name",
     "asname",
 };
-static PyObject* ast2obj_withitem(struct ast_state *state, void*);
+static PyObject* ast2obj_withitem(struct ast_state *state, PyObject *lazy,
+                                  void*);
 static const char * const withitem_fields[]={
     "context_expr",
     "optional_vars",
 };
-static PyObject* ast2obj_match_case(struct ast_state *state, void*);
+static PyObject* ast2obj_match_case(struct ast_state *state, PyObject *lazy,
+                                    void*);
 static const char * const match_case_fields[]={
     "pattern",
     "guard",
@@ -755,7 +768,8 @@ static const char * const pattern_attributes[] = {
     "end_lineno",
     "end_col_offset",
 };
-static PyObject* ast2obj_pattern(struct ast_state *state, void*);
+static PyObject* ast2obj_pattern(struct ast_state *state, PyObject *lazy,
+                                 void*);
 static const char * const MatchValue_fields[]={
     "value",
 };
@@ -786,7 +800,8 @@ static const char * const MatchAs_fields[]={
 static const char * const MatchOr_fields[]={
     "patterns",
 };
-static PyObject* ast2obj_type_ignore(struct ast_state *state, void*);
+static PyObject* ast2obj_type_ignore(struct ast_state *state, PyObject *lazy,
+                                     void*);
 static const char * const TypeIgnore_fields[]={
     "lineno",
     "tag",
@@ -797,7 +812,8 @@ static const char * const type_param_attributes[] = {
     "end_lineno",
     "end_col_offset",
 };
-static PyObject* ast2obj_type_param(struct ast_state *state, void*);
+static PyObject* ast2obj_type_param(struct ast_state *state, PyObject *lazy,
+                                    void*);
 static const char * const TypeVar_fields[]={
     "name",
     "bound",
@@ -5124,8 +5140,60 @@ add_ast_annotations(struct ast_state *state)
 typedef struct {
     PyObject_HEAD
     PyObject *dict;
+    /* Set for the nodes of a lazy AST (see PyAST_mod2obj_lazy()) until
+       their fields are converted: the C node and the object which keeps
+       its arena alive. */
+    void *lazy_node;
+    PyObject *lazy_owner;
 } AST_object;
 
+static int ast2obj_lazy_fields(struct ast_state *state, PyObject *lazy,
+                               PyObject *result, void *node);
+
+/* Convert the fields of a node of a lazy AST, if not done yet.  Its
+   children are created lazily in turn. */
+static int
+ast_materialize(AST_object *self)
+{
+    if (FT_ATOMIC_LOAD_PTR_ACQUIRE(self->lazy_node) == NULL) {
+        return 0;
+    }
+    struct ast_state *state = get_ast_state();
+    if (state == NULL) {
+        return -1;
+    }
+    int res = 0;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    if (self->lazy_node != NULL) {
+        res = ast2obj_lazy_fields(state, self->lazy_owner, (PyObject *)self,
+                                  self->lazy_node);
+        if (res == 0) {
+            FT_ATOMIC_STORE_PTR_RELEASE(self->lazy_node, NULL);
+            Py_CLEAR(self->lazy_owner);
+        }
+    }
+    Py_END_CRITICAL_SECTION();
+    return res;
+}
+
+static PyObject *
+ast_getattro(PyObject *op, PyObject *name)
+{
+    if (ast_materialize((AST_object*)op) < 0) {
+        return NULL;
+    }
+    return PyObject_GenericGetAttr(op, name);
+}
+
+static int
+ast_setattro(PyObject *op, PyObject *name, PyObject *value)
+{
+    if (ast_materialize((AST_object*)op) < 0) {
+        return -1;
+    }
+    return PyObject_GenericSetAttr(op, name, value);
+}
+
 static void
 ast_dealloc(PyObject *op)
 {
@@ -5134,6 +5202,7 @@ ast_dealloc(PyObject *op)
     PyTypeObject *tp = Py_TYPE(self);
     PyObject_GC_UnTrack(self);
     Py_CLEAR(self->dict);
+    Py_CLEAR(self->lazy_owner);
     freefunc free_func = PyType_GetSlot(tp, Py_tp_free);
     assert(free_func != NULL);
     free_func(self);
@@ -5146,6 +5215,7 @@ ast_traverse(PyObject *op, visitproc visit, void *arg)
     AST_object *self = (AST_object*)op;
     Py_VISIT(Py_TYPE(self));
     Py_VISIT(self->dict);
+    Py_VISIT(self->lazy_owner);
     return 0;
 }
 
@@ -5154,6 +5224,8 @@ ast_clear(PyObject *op)
 {
     AST_object *self = (AST_object*)op;
     Py_CLEAR(self->dict);
+    self->lazy_node = NULL;
+    Py_CLEAR(self->lazy_owner);
     return 0;
 }
 
@@ -5973,8 +6045,8 @@ ast_repr(PyObject *self)
 static PyType_Slot AST_type_slots[] = {
     {Py_tp_dealloc, ast_dealloc},
     {Py_tp_repr, ast_repr},
-    {Py_tp_getattro, PyObject_GenericGetAttr},
-    {Py_tp_setattro, PyObject_GenericSetAttr},
+    {Py_tp_getattro, ast_getattro},
+    {Py_tp_setattro, ast_setattro},
     {Py_tp_traverse, ast_traverse},
     {Py_tp_clear, ast_clear},
     {Py_tp_members, ast_type_members},
@@ -6044,8 +6116,42 @@ add_attributes(struct ast_state *state, PyObject *type, const char * const *attr
 
 /* Conversion AST -> Python */
 
-static PyObject* ast2obj_list(struct ast_state *state, asdl_seq *seq,
-                              PyObject* (*func)(struct ast_state *state, void*))
+typedef int (*ast2obj_fields_func)(struct ast_state *state, PyObject *lazy,
+                                   PyObject *result, void *node);
+
+/* Create a node of type tp for the C node.  If lazy is NULL, its fields
+   are converted right away by fill.  Otherwise they are converted on first
+   access, and lazy is the object which owns the arena of the C AST. */
+static PyObject* ast2obj_node(struct ast_state *state, PyObject *lazy,
+                              PyObject *tp, void *node,
+                              ast2obj_fields_func fill)
+{
+    PyObject *result = PyType_GenericNew((PyTypeObject *)tp, NULL, NULL);
+    if (!result) {
+        return NULL;
+    }
+    if (lazy != NULL) {
+        ((AST_object *)result)->lazy_node = node;
+        ((AST_object *)result)->lazy_owner = Py_NewRef(lazy);
+        return result;
+    }
+    if (Py_EnterRecursiveCall("during  ast construction")) {
+        Py_DECREF(result);
+        return NULL;
+    }
+    int res = fill(state, NULL, result, node);
+    Py_LeaveRecursiveCall();
+    if (res < 0) {
+        Py_DECREF(result);
+        return NULL;
+    }
+    return result;
+}
+
+static PyObject* ast2obj_list(struct ast_state *state, PyObject *lazy,
+                              asdl_seq *seq,
+                              PyObject* (*func)(struct ast_state *state,
+                                                PyObject *lazy, void*))
 {
     Py_ssize_t i, n = asdl_seq_LEN(seq);
     PyObject *result = PyList_New(n);
@@ -6053,7 +6159,7 @@ static PyObject* ast2obj_list(struct ast_state *state, asdl_seq *seq,
     if (!result)
         return NULL;
     for (i = 0; i < n; i++) {
-        value = func(state, asdl_seq_GET_UNTYPED(seq, i));
+        value = func(state, lazy, asdl_seq_GET_UNTYPED(seq, i));
         if (!value) {
             Py_DECREF(result);
             return NULL;
@@ -6063,7 +6169,8 @@ static PyObject* ast2obj_list(struct ast_state *state, asdl_seq *seq,
     return result;
 }
 
-static PyObject* ast2obj_object(struct ast_state *Py_UNUSED(state), void *o)
+static PyObject* ast2obj_object(struct ast_state *Py_UNUSED(state),
+                                PyObject *Py_UNUSED(lazy), void *o)
 {
     PyObject *op = (PyObject*)o;
     if (!op) {
@@ -6075,7 +6182,8 @@ static PyObject* ast2obj_object(struct ast_state *Py_UNUSED(state), void *o)
 #define ast2obj_identifier ast2obj_object
 #define ast2obj_string ast2obj_object
 
-static PyObject* ast2obj_int(struct ast_state *Py_UNUSED(state), long b)
+static PyObject* ast2obj_int(struct ast_state *Py_UNUSED(state),
+                             PyObject *Py_UNUSED(lazy), long b)
 {
     return PyLong_FromLong(b);
 }
@@ -8884,931 +8992,910 @@ _PyAST_TypeVarTuple(identifier name, expr_ty default_value, int lineno, int
 }
 
 
-PyObject*
-ast2obj_mod(struct ast_state *state, void* _o)
+static int
+ast2obj_mod_fields(struct ast_state *state, PyObject *lazy,
+                   PyObject *result, void* _o)
 {
     mod_ty o = (mod_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
-    if (!o) {
-        Py_RETURN_NONE;
-    }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
-    }
+    PyObject *value = NULL;
     switch (o->kind) {
     case Module_kind:
-        tp = (PyTypeObject *)state->Module_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.Module.body, ast2obj_stmt);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Module.body,
+                             ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.Module.type_ignores,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Module.type_ignores,
                              ast2obj_type_ignore);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->type_ignores, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->type_ignores, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Interactive_kind:
-        tp = (PyTypeObject *)state->Interactive_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.Interactive.body,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Interactive.body,
                              ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Expression_kind:
-        tp = (PyTypeObject *)state->Expression_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Expression.body);
+        value = ast2obj_expr(state, lazy, o->v.Expression.body);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case FunctionType_kind:
-        tp = (PyTypeObject *)state->FunctionType_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.FunctionType.argtypes,
+        value = ast2obj_list(state, lazy,
+                             (asdl_seq*)o->v.FunctionType.argtypes,
                              ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->argtypes, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->argtypes, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.FunctionType.returns);
+        value = ast2obj_expr(state, lazy, o->v.FunctionType.returns);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->returns, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->returns, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     }
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
 }
 
 PyObject*
-ast2obj_stmt(struct ast_state *state, void* _o)
+ast2obj_mod(struct ast_state *state, PyObject *lazy, void* _o)
 {
-    stmt_ty o = (stmt_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
+    mod_ty o = (mod_ty)_o;
     if (!o) {
         Py_RETURN_NONE;
     }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
+    PyObject *tp;
+    switch (o->kind) {
+    case Module_kind:
+        tp = state->Module_type;
+        break;
+    case Interactive_kind:
+        tp = state->Interactive_type;
+        break;
+    case Expression_kind:
+        tp = state->Expression_type;
+        break;
+    case FunctionType_kind:
+        tp = state->FunctionType_type;
+        break;
+    default:
+        Py_UNREACHABLE();
     }
+    return ast2obj_node(state, lazy, tp, o, ast2obj_mod_fields);
+}
+
+static int
+ast2obj_stmt_fields(struct ast_state *state, PyObject *lazy,
+                    PyObject *result, void* _o)
+{
+    stmt_ty o = (stmt_ty)_o;
+    PyObject *value = NULL;
     switch (o->kind) {
     case FunctionDef_kind:
-        tp = (PyTypeObject *)state->FunctionDef_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_identifier(state, o->v.FunctionDef.name);
+        value = ast2obj_identifier(state, lazy, o->v.FunctionDef.name);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->name, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->name, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_arguments(state, o->v.FunctionDef.args);
+        value = ast2obj_arguments(state, lazy, o->v.FunctionDef.args);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->args, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->args, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.FunctionDef.body,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.FunctionDef.body,
                              ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.FunctionDef.decorator_list,
+        value = ast2obj_list(state, lazy,
+                             (asdl_seq*)o->v.FunctionDef.decorator_list,
                              ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->decorator_list, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->decorator_list, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.FunctionDef.returns);
+        value = ast2obj_expr(state, lazy, o->v.FunctionDef.returns);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->returns, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->returns, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_string(state, o->v.FunctionDef.type_comment);
+        value = ast2obj_string(state, lazy, o->v.FunctionDef.type_comment);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->type_comment, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->type_comment, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.FunctionDef.type_params,
+        value = ast2obj_list(state, lazy,
+                             (asdl_seq*)o->v.FunctionDef.type_params,
                              ast2obj_type_param);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->type_params, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->type_params, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case AsyncFunctionDef_kind:
-        tp = (PyTypeObject *)state->AsyncFunctionDef_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_identifier(state, o->v.AsyncFunctionDef.name);
+        value = ast2obj_identifier(state, lazy, o->v.AsyncFunctionDef.name);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->name, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->name, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_arguments(state, o->v.AsyncFunctionDef.args);
+        value = ast2obj_arguments(state, lazy, o->v.AsyncFunctionDef.args);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->args, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->args, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.AsyncFunctionDef.body,
+        value = ast2obj_list(state, lazy,
+                             (asdl_seq*)o->v.AsyncFunctionDef.body,
                              ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state,
+        value = ast2obj_list(state, lazy,
                              (asdl_seq*)o->v.AsyncFunctionDef.decorator_list,
                              ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->decorator_list, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->decorator_list, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.AsyncFunctionDef.returns);
+        value = ast2obj_expr(state, lazy, o->v.AsyncFunctionDef.returns);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->returns, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->returns, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_string(state, o->v.AsyncFunctionDef.type_comment);
+        value = ast2obj_string(state, lazy, o->v.AsyncFunctionDef.type_comment);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->type_comment, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->type_comment, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state,
+        value = ast2obj_list(state, lazy,
                              (asdl_seq*)o->v.AsyncFunctionDef.type_params,
                              ast2obj_type_param);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->type_params, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->type_params, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case ClassDef_kind:
-        tp = (PyTypeObject *)state->ClassDef_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_identifier(state, o->v.ClassDef.name);
+        value = ast2obj_identifier(state, lazy, o->v.ClassDef.name);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->name, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->name, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.ClassDef.bases,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.ClassDef.bases,
                              ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->bases, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->bases, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.ClassDef.keywords,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.ClassDef.keywords,
                              ast2obj_keyword);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->keywords, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->keywords, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.ClassDef.body,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.ClassDef.body,
                              ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.ClassDef.decorator_list,
+        value = ast2obj_list(state, lazy,
+                             (asdl_seq*)o->v.ClassDef.decorator_list,
                              ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->decorator_list, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->decorator_list, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.ClassDef.type_params,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.ClassDef.type_params,
                              ast2obj_type_param);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->type_params, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->type_params, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Return_kind:
-        tp = (PyTypeObject *)state->Return_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Return.value);
+        value = ast2obj_expr(state, lazy, o->v.Return.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Delete_kind:
-        tp = (PyTypeObject *)state->Delete_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.Delete.targets,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Delete.targets,
                              ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->targets, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->targets, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Assign_kind:
-        tp = (PyTypeObject *)state->Assign_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.Assign.targets,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Assign.targets,
                              ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->targets, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->targets, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.Assign.value);
+        value = ast2obj_expr(state, lazy, o->v.Assign.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_string(state, o->v.Assign.type_comment);
+        value = ast2obj_string(state, lazy, o->v.Assign.type_comment);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->type_comment, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->type_comment, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case TypeAlias_kind:
-        tp = (PyTypeObject *)state->TypeAlias_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.TypeAlias.name);
+        value = ast2obj_expr(state, lazy, o->v.TypeAlias.name);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->name, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->name, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.TypeAlias.type_params,
+        value = ast2obj_list(state, lazy,
+                             (asdl_seq*)o->v.TypeAlias.type_params,
                              ast2obj_type_param);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->type_params, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->type_params, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.TypeAlias.value);
+        value = ast2obj_expr(state, lazy, o->v.TypeAlias.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case AugAssign_kind:
-        tp = (PyTypeObject *)state->AugAssign_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.AugAssign.target);
+        value = ast2obj_expr(state, lazy, o->v.AugAssign.target);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->target, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->target, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_operator(state, o->v.AugAssign.op);
+        value = ast2obj_operator(state, lazy, o->v.AugAssign.op);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->op, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->op, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.AugAssign.value);
+        value = ast2obj_expr(state, lazy, o->v.AugAssign.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case AnnAssign_kind:
-        tp = (PyTypeObject *)state->AnnAssign_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.AnnAssign.target);
+        value = ast2obj_expr(state, lazy, o->v.AnnAssign.target);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->target, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->target, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.AnnAssign.annotation);
+        value = ast2obj_expr(state, lazy, o->v.AnnAssign.annotation);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->annotation, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->annotation, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.AnnAssign.value);
+        value = ast2obj_expr(state, lazy, o->v.AnnAssign.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_int(state, o->v.AnnAssign.simple);
+        value = ast2obj_int(state, lazy, o->v.AnnAssign.simple);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->simple, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->simple, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case For_kind:
-        tp = (PyTypeObject *)state->For_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.For.target);
+        value = ast2obj_expr(state, lazy, o->v.For.target);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->target, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->target, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.For.iter);
+        value = ast2obj_expr(state, lazy, o->v.For.iter);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->iter, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->iter, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.For.body, ast2obj_stmt);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.For.body,
+                             ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.For.orelse, ast2obj_stmt);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.For.orelse,
+                             ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->orelse, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->orelse, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_string(state, o->v.For.type_comment);
+        value = ast2obj_string(state, lazy, o->v.For.type_comment);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->type_comment, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->type_comment, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case AsyncFor_kind:
-        tp = (PyTypeObject *)state->AsyncFor_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.AsyncFor.target);
+        value = ast2obj_expr(state, lazy, o->v.AsyncFor.target);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->target, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->target, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.AsyncFor.iter);
+        value = ast2obj_expr(state, lazy, o->v.AsyncFor.iter);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->iter, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->iter, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.AsyncFor.body,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.AsyncFor.body,
                              ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.AsyncFor.orelse,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.AsyncFor.orelse,
                              ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->orelse, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->orelse, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_string(state, o->v.AsyncFor.type_comment);
+        value = ast2obj_string(state, lazy, o->v.AsyncFor.type_comment);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->type_comment, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->type_comment, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case While_kind:
-        tp = (PyTypeObject *)state->While_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.While.test);
+        value = ast2obj_expr(state, lazy, o->v.While.test);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->test, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->test, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.While.body, ast2obj_stmt);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.While.body,
+                             ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.While.orelse, ast2obj_stmt);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.While.orelse,
+                             ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->orelse, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->orelse, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case If_kind:
-        tp = (PyTypeObject *)state->If_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.If.test);
+        value = ast2obj_expr(state, lazy, o->v.If.test);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->test, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->test, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.If.body, ast2obj_stmt);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.If.body,
+                             ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.If.orelse, ast2obj_stmt);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.If.orelse,
+                             ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->orelse, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->orelse, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case With_kind:
-        tp = (PyTypeObject *)state->With_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.With.items,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.With.items,
                              ast2obj_withitem);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->items, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->items, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.With.body, ast2obj_stmt);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.With.body,
+                             ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_string(state, o->v.With.type_comment);
+        value = ast2obj_string(state, lazy, o->v.With.type_comment);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->type_comment, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->type_comment, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case AsyncWith_kind:
-        tp = (PyTypeObject *)state->AsyncWith_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.AsyncWith.items,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.AsyncWith.items,
                              ast2obj_withitem);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->items, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->items, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.AsyncWith.body,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.AsyncWith.body,
                              ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_string(state, o->v.AsyncWith.type_comment);
+        value = ast2obj_string(state, lazy, o->v.AsyncWith.type_comment);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->type_comment, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->type_comment, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Match_kind:
-        tp = (PyTypeObject *)state->Match_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Match.subject);
+        value = ast2obj_expr(state, lazy, o->v.Match.subject);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->subject, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->subject, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.Match.cases,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Match.cases,
                              ast2obj_match_case);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->cases, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->cases, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Raise_kind:
-        tp = (PyTypeObject *)state->Raise_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Raise.exc);
+        value = ast2obj_expr(state, lazy, o->v.Raise.exc);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->exc, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->exc, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.Raise.cause);
+        value = ast2obj_expr(state, lazy, o->v.Raise.cause);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->cause, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->cause, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Try_kind:
-        tp = (PyTypeObject *)state->Try_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.Try.body, ast2obj_stmt);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Try.body,
+                             ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.Try.handlers,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Try.handlers,
                              ast2obj_excepthandler);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->handlers, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->handlers, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.Try.orelse, ast2obj_stmt);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Try.orelse,
+                             ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->orelse, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->orelse, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.Try.finalbody,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Try.finalbody,
                              ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->finalbody, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->finalbody, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case TryStar_kind:
-        tp = (PyTypeObject *)state->TryStar_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.TryStar.body, ast2obj_stmt);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.TryStar.body,
+                             ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.TryStar.handlers,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.TryStar.handlers,
                              ast2obj_excepthandler);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->handlers, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->handlers, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.TryStar.orelse,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.TryStar.orelse,
                              ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->orelse, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->orelse, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.TryStar.finalbody,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.TryStar.finalbody,
                              ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->finalbody, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->finalbody, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Assert_kind:
-        tp = (PyTypeObject *)state->Assert_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Assert.test);
+        value = ast2obj_expr(state, lazy, o->v.Assert.test);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->test, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->test, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.Assert.msg);
+        value = ast2obj_expr(state, lazy, o->v.Assert.msg);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->msg, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->msg, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Import_kind:
-        tp = (PyTypeObject *)state->Import_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.Import.names,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Import.names,
                              ast2obj_alias);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->names, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->names, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case ImportFrom_kind:
-        tp = (PyTypeObject *)state->ImportFrom_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_identifier(state, o->v.ImportFrom.module);
+        value = ast2obj_identifier(state, lazy, o->v.ImportFrom.module);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->module, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->module, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.ImportFrom.names,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.ImportFrom.names,
                              ast2obj_alias);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->names, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->names, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_int(state, o->v.ImportFrom.level);
+        value = ast2obj_int(state, lazy, o->v.ImportFrom.level);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->level, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->level, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Global_kind:
-        tp = (PyTypeObject *)state->Global_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.Global.names,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Global.names,
                              ast2obj_identifier);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->names, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->names, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Nonlocal_kind:
-        tp = (PyTypeObject *)state->Nonlocal_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.Nonlocal.names,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Nonlocal.names,
                              ast2obj_identifier);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->names, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->names, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Expr_kind:
-        tp = (PyTypeObject *)state->Expr_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Expr.value);
+        value = ast2obj_expr(state, lazy, o->v.Expr.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Pass_kind:
-        tp = (PyTypeObject *)state->Pass_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
         break;
     case Break_kind:
-        tp = (PyTypeObject *)state->Break_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
         break;
     case Continue_kind:
-        tp = (PyTypeObject *)state->Continue_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
         break;
     }
-    value = ast2obj_int(state, o->lineno);
+    value = ast2obj_int(state, lazy, o->lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->col_offset);
+    value = ast2obj_int(state, lazy, o->col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_lineno);
+    value = ast2obj_int(state, lazy, o->end_lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_col_offset);
+    value = ast2obj_int(state, lazy, o->end_col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
 }
 
 PyObject*
-ast2obj_expr(struct ast_state *state, void* _o)
+ast2obj_stmt(struct ast_state *state, PyObject *lazy, void* _o)
 {
-    expr_ty o = (expr_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
+    stmt_ty o = (stmt_ty)_o;
     if (!o) {
         Py_RETURN_NONE;
     }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
+    PyObject *tp;
+    switch (o->kind) {
+    case FunctionDef_kind:
+        tp = state->FunctionDef_type;
+        break;
+    case AsyncFunctionDef_kind:
+        tp = state->AsyncFunctionDef_type;
+        break;
+    case ClassDef_kind:
+        tp = state->ClassDef_type;
+        break;
+    case Return_kind:
+        tp = state->Return_type;
+        break;
+    case Delete_kind:
+        tp = state->Delete_type;
+        break;
+    case Assign_kind:
+        tp = state->Assign_type;
+        break;
+    case TypeAlias_kind:
+        tp = state->TypeAlias_type;
+        break;
+    case AugAssign_kind:
+        tp = state->AugAssign_type;
+        break;
+    case AnnAssign_kind:
+        tp = state->AnnAssign_type;
+        break;
+    case For_kind:
+        tp = state->For_type;
+        break;
+    case AsyncFor_kind:
+        tp = state->AsyncFor_type;
+        break;
+    case While_kind:
+        tp = state->While_type;
+        break;
+    case If_kind:
+        tp = state->If_type;
+        break;
+    case With_kind:
+        tp = state->With_type;
+        break;
+    case AsyncWith_kind:
+        tp = state->AsyncWith_type;
+        break;
+    case Match_kind:
+        tp = state->Match_type;
+        break;
+    case Raise_kind:
+        tp = state->Raise_type;
+        break;
+    case Try_kind:
+        tp = state->Try_type;
+        break;
+    case TryStar_kind:
+        tp = state->TryStar_type;
+        break;
+    case Assert_kind:
+        tp = state->Assert_type;
+        break;
+    case Import_kind:
+        tp = state->Import_type;
+        break;
+    case ImportFrom_kind:
+        tp = state->ImportFrom_type;
+        break;
+    case Global_kind:
+        tp = state->Global_type;
+        break;
+    case Nonlocal_kind:
+        tp = state->Nonlocal_type;
+        break;
+    case Expr_kind:
+        tp = state->Expr_type;
+        break;
+    case Pass_kind:
+        tp = state->Pass_type;
+        break;
+    case Break_kind:
+        tp = state->Break_type;
+        break;
+    case Continue_kind:
+        tp = state->Continue_type;
+        break;
+    default:
+        Py_UNREACHABLE();
     }
+    return ast2obj_node(state, lazy, tp, o, ast2obj_stmt_fields);
+}
+
+static int
+ast2obj_expr_fields(struct ast_state *state, PyObject *lazy,
+                    PyObject *result, void* _o)
+{
+    expr_ty o = (expr_ty)_o;
+    PyObject *value = NULL;
     switch (o->kind) {
     case BoolOp_kind:
-        tp = (PyTypeObject *)state->BoolOp_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_boolop(state, o->v.BoolOp.op);
+        value = ast2obj_boolop(state, lazy, o->v.BoolOp.op);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->op, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->op, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.BoolOp.values,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.BoolOp.values,
                              ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->values, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->values, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case NamedExpr_kind:
-        tp = (PyTypeObject *)state->NamedExpr_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.NamedExpr.target);
+        value = ast2obj_expr(state, lazy, o->v.NamedExpr.target);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->target, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->target, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.NamedExpr.value);
+        value = ast2obj_expr(state, lazy, o->v.NamedExpr.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case BinOp_kind:
-        tp = (PyTypeObject *)state->BinOp_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.BinOp.left);
+        value = ast2obj_expr(state, lazy, o->v.BinOp.left);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->left, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->left, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_operator(state, o->v.BinOp.op);
+        value = ast2obj_operator(state, lazy, o->v.BinOp.op);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->op, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->op, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.BinOp.right);
+        value = ast2obj_expr(state, lazy, o->v.BinOp.right);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->right, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->right, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case UnaryOp_kind:
-        tp = (PyTypeObject *)state->UnaryOp_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_unaryop(state, o->v.UnaryOp.op);
+        value = ast2obj_unaryop(state, lazy, o->v.UnaryOp.op);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->op, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->op, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.UnaryOp.operand);
+        value = ast2obj_expr(state, lazy, o->v.UnaryOp.operand);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->operand, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->operand, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Lambda_kind:
-        tp = (PyTypeObject *)state->Lambda_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_arguments(state, o->v.Lambda.args);
+        value = ast2obj_arguments(state, lazy, o->v.Lambda.args);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->args, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->args, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.Lambda.body);
+        value = ast2obj_expr(state, lazy, o->v.Lambda.body);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case IfExp_kind:
-        tp = (PyTypeObject *)state->IfExp_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.IfExp.test);
+        value = ast2obj_expr(state, lazy, o->v.IfExp.test);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->test, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->test, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.IfExp.body);
+        value = ast2obj_expr(state, lazy, o->v.IfExp.body);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.IfExp.orelse);
+        value = ast2obj_expr(state, lazy, o->v.IfExp.orelse);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->orelse, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->orelse, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Dict_kind:
-        tp = (PyTypeObject *)state->Dict_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.Dict.keys, ast2obj_expr);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Dict.keys,
+                             ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->keys, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->keys, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.Dict.values, ast2obj_expr);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Dict.values,
+                             ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->values, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->values, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Set_kind:
-        tp = (PyTypeObject *)state->Set_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.Set.elts, ast2obj_expr);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Set.elts,
+                             ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->elts, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->elts, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case ListComp_kind:
-        tp = (PyTypeObject *)state->ListComp_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.ListComp.elt);
+        value = ast2obj_expr(state, lazy, o->v.ListComp.elt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->elt, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->elt, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.ListComp.generators,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.ListComp.generators,
                              ast2obj_comprehension);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->generators, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->generators, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case SetComp_kind:
-        tp = (PyTypeObject *)state->SetComp_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.SetComp.elt);
+        value = ast2obj_expr(state, lazy, o->v.SetComp.elt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->elt, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->elt, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.SetComp.generators,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.SetComp.generators,
                              ast2obj_comprehension);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->generators, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->generators, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case DictComp_kind:
-        tp = (PyTypeObject *)state->DictComp_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.DictComp.key);
+        value = ast2obj_expr(state, lazy, o->v.DictComp.key);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->key, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->key, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.DictComp.value);
+        value = ast2obj_expr(state, lazy, o->v.DictComp.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.DictComp.generators,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.DictComp.generators,
                              ast2obj_comprehension);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->generators, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->generators, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case GeneratorExp_kind:
-        tp = (PyTypeObject *)state->GeneratorExp_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.GeneratorExp.elt);
+        value = ast2obj_expr(state, lazy, o->v.GeneratorExp.elt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->elt, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->elt, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.GeneratorExp.generators,
+        value = ast2obj_list(state, lazy,
+                             (asdl_seq*)o->v.GeneratorExp.generators,
                              ast2obj_comprehension);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->generators, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->generators, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Await_kind:
-        tp = (PyTypeObject *)state->Await_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Await.value);
+        value = ast2obj_expr(state, lazy, o->v.Await.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Yield_kind:
-        tp = (PyTypeObject *)state->Yield_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Yield.value);
+        value = ast2obj_expr(state, lazy, o->v.Yield.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case YieldFrom_kind:
-        tp = (PyTypeObject *)state->YieldFrom_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.YieldFrom.value);
+        value = ast2obj_expr(state, lazy, o->v.YieldFrom.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Compare_kind:
-        tp = (PyTypeObject *)state->Compare_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Compare.left);
+        value = ast2obj_expr(state, lazy, o->v.Compare.left);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->left, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->left, value) == -1)
             goto failed;
         Py_DECREF(value);
         {
@@ -9816,273 +9903,337 @@ ast2obj_expr(struct ast_state *state, void* _o)
             value = PyList_New(n);
             if (!value) goto failed;
             for(i = 0; i < n; i++)
-                PyList_SET_ITEM(value, i, ast2obj_cmpop(state, (cmpop_ty)asdl_seq_GET(o->v.Compare.ops, i)));
+                PyList_SET_ITEM(value, i, ast2obj_cmpop(state, lazy, (cmpop_ty)asdl_seq_GET(o->v.Compare.ops, i)));
         }
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->ops, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->ops, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.Compare.comparators,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Compare.comparators,
                              ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->comparators, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->comparators, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Call_kind:
-        tp = (PyTypeObject *)state->Call_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Call.func);
+        value = ast2obj_expr(state, lazy, o->v.Call.func);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->func, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->func, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.Call.args, ast2obj_expr);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Call.args,
+                             ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->args, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->args, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.Call.keywords,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Call.keywords,
                              ast2obj_keyword);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->keywords, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->keywords, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case FormattedValue_kind:
-        tp = (PyTypeObject *)state->FormattedValue_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.FormattedValue.value);
+        value = ast2obj_expr(state, lazy, o->v.FormattedValue.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_int(state, o->v.FormattedValue.conversion);
+        value = ast2obj_int(state, lazy, o->v.FormattedValue.conversion);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->conversion, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->conversion, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.FormattedValue.format_spec);
+        value = ast2obj_expr(state, lazy, o->v.FormattedValue.format_spec);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->format_spec, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->format_spec, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Interpolation_kind:
-        tp = (PyTypeObject *)state->Interpolation_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Interpolation.value);
+        value = ast2obj_expr(state, lazy, o->v.Interpolation.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_constant(state, o->v.Interpolation.str);
+        value = ast2obj_constant(state, lazy, o->v.Interpolation.str);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->str, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->str, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_int(state, o->v.Interpolation.conversion);
+        value = ast2obj_int(state, lazy, o->v.Interpolation.conversion);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->conversion, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->conversion, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.Interpolation.format_spec);
+        value = ast2obj_expr(state, lazy, o->v.Interpolation.format_spec);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->format_spec, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->format_spec, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case JoinedStr_kind:
-        tp = (PyTypeObject *)state->JoinedStr_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.JoinedStr.values,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.JoinedStr.values,
                              ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->values, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->values, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case TemplateStr_kind:
-        tp = (PyTypeObject *)state->TemplateStr_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.TemplateStr.values,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.TemplateStr.values,
                              ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->values, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->values, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Constant_kind:
-        tp = (PyTypeObject *)state->Constant_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_constant(state, o->v.Constant.value);
+        value = ast2obj_constant(state, lazy, o->v.Constant.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_string(state, o->v.Constant.kind);
+        value = ast2obj_string(state, lazy, o->v.Constant.kind);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->kind, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->kind, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Attribute_kind:
-        tp = (PyTypeObject *)state->Attribute_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Attribute.value);
+        value = ast2obj_expr(state, lazy, o->v.Attribute.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_identifier(state, o->v.Attribute.attr);
+        value = ast2obj_identifier(state, lazy, o->v.Attribute.attr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->attr, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->attr, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr_context(state, o->v.Attribute.ctx);
+        value = ast2obj_expr_context(state, lazy, o->v.Attribute.ctx);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->ctx, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->ctx, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Subscript_kind:
-        tp = (PyTypeObject *)state->Subscript_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Subscript.value);
+        value = ast2obj_expr(state, lazy, o->v.Subscript.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.Subscript.slice);
+        value = ast2obj_expr(state, lazy, o->v.Subscript.slice);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->slice, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->slice, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr_context(state, o->v.Subscript.ctx);
+        value = ast2obj_expr_context(state, lazy, o->v.Subscript.ctx);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->ctx, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->ctx, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Starred_kind:
-        tp = (PyTypeObject *)state->Starred_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Starred.value);
+        value = ast2obj_expr(state, lazy, o->v.Starred.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr_context(state, o->v.Starred.ctx);
+        value = ast2obj_expr_context(state, lazy, o->v.Starred.ctx);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->ctx, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->ctx, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Name_kind:
-        tp = (PyTypeObject *)state->Name_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_identifier(state, o->v.Name.id);
+        value = ast2obj_identifier(state, lazy, o->v.Name.id);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->id, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->id, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr_context(state, o->v.Name.ctx);
+        value = ast2obj_expr_context(state, lazy, o->v.Name.ctx);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->ctx, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->ctx, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case List_kind:
-        tp = (PyTypeObject *)state->List_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.List.elts, ast2obj_expr);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.List.elts,
+                             ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->elts, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->elts, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr_context(state, o->v.List.ctx);
+        value = ast2obj_expr_context(state, lazy, o->v.List.ctx);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->ctx, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->ctx, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Tuple_kind:
-        tp = (PyTypeObject *)state->Tuple_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.Tuple.elts, ast2obj_expr);
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.Tuple.elts,
+                             ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->elts, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->elts, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr_context(state, o->v.Tuple.ctx);
+        value = ast2obj_expr_context(state, lazy, o->v.Tuple.ctx);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->ctx, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->ctx, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case Slice_kind:
-        tp = (PyTypeObject *)state->Slice_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.Slice.lower);
+        value = ast2obj_expr(state, lazy, o->v.Slice.lower);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->lower, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->lower, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.Slice.upper);
+        value = ast2obj_expr(state, lazy, o->v.Slice.upper);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->upper, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->upper, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.Slice.step);
+        value = ast2obj_expr(state, lazy, o->v.Slice.step);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->step, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->step, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     }
-    value = ast2obj_int(state, o->lineno);
+    value = ast2obj_int(state, lazy, o->lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->col_offset);
+    value = ast2obj_int(state, lazy, o->col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_lineno);
+    value = ast2obj_int(state, lazy, o->end_lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_col_offset);
+    value = ast2obj_int(state, lazy, o->end_col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
+}
+
+PyObject*
+ast2obj_expr(struct ast_state *state, PyObject *lazy, void* _o)
+{
+    expr_ty o = (expr_ty)_o;
+    if (!o) {
+        Py_RETURN_NONE;
+    }
+    PyObject *tp;
+    switch (o->kind) {
+    case BoolOp_kind:
+        tp = state->BoolOp_type;
+        break;
+    case NamedExpr_kind:
+        tp = state->NamedExpr_type;
+        break;
+    case BinOp_kind:
+        tp = state->BinOp_type;
+        break;
+    case UnaryOp_kind:
+        tp = state->UnaryOp_type;
+        break;
+    case Lambda_kind:
+        tp = state->Lambda_type;
+        break;
+    case IfExp_kind:
+        tp = state->IfExp_type;
+        break;
+    case Dict_kind:
+        tp = state->Dict_type;
+        break;
+    case Set_kind:
+        tp = state->Set_type;
+        break;
+    case ListComp_kind:
+        tp = state->ListComp_type;
+        break;
+    case SetComp_kind:
+        tp = state->SetComp_type;
+        break;
+    case DictComp_kind:
+        tp = state->DictComp_type;
+        break;
+    case GeneratorExp_kind:
+        tp = state->GeneratorExp_type;
+        break;
+    case Await_kind:
+        tp = state->Await_type;
+        break;
+    case Yield_kind:
+        tp = state->Yield_type;
+        break;
+    case YieldFrom_kind:
+        tp = state->YieldFrom_type;
+        break;
+    case Compare_kind:
+        tp = state->Compare_type;
+        break;
+    case Call_kind:
+        tp = state->Call_type;
+        break;
+    case FormattedValue_kind:
+        tp = state->FormattedValue_type;
+        break;
+    case Interpolation_kind:
+        tp = state->Interpolation_type;
+        break;
+    case JoinedStr_kind:
+        tp = state->JoinedStr_type;
+        break;
+    case TemplateStr_kind:
+        tp = state->TemplateStr_type;
+        break;
+    case Constant_kind:
+        tp = state->Constant_type;
+        break;
+    case Attribute_kind:
+        tp = state->Attribute_type;
+        break;
+    case Subscript_kind:
+        tp = state->Subscript_type;
+        break;
+    case Starred_kind:
+        tp = state->Starred_type;
+        break;
+    case Name_kind:
+        tp = state->Name_type;
+        break;
+    case List_kind:
+        tp = state->List_type;
+        break;
+    case Tuple_kind:
+        tp = state->Tuple_type;
+        break;
+    case Slice_kind:
+        tp = state->Slice_type;
+        break;
+    default:
+        Py_UNREACHABLE();
+    }
+    return ast2obj_node(state, lazy, tp, o, ast2obj_expr_fields);
 }
 
-PyObject* ast2obj_expr_context(struct ast_state *state, expr_context_ty o)
+PyObject* ast2obj_expr_context(struct ast_state *state, PyObject
+                               *Py_UNUSED(lazy), expr_context_ty o)
 {
     switch(o) {
         case Load:
@@ -10094,7 +10245,8 @@ PyObject* ast2obj_expr_context(struct ast_state *state, expr_context_ty o)
     }
     Py_UNREACHABLE();
 }
-PyObject* ast2obj_boolop(struct ast_state *state, boolop_ty o)
+PyObject* ast2obj_boolop(struct ast_state *state, PyObject *Py_UNUSED(lazy),
+                         boolop_ty o)
 {
     switch(o) {
         case And:
@@ -10104,7 +10256,8 @@ PyObject* ast2obj_boolop(struct ast_state *state, boolop_ty o)
     }
     Py_UNREACHABLE();
 }
-PyObject* ast2obj_operator(struct ast_state *state, operator_ty o)
+PyObject* ast2obj_operator(struct ast_state *state, PyObject *Py_UNUSED(lazy),
+                           operator_ty o)
 {
     switch(o) {
         case Add:
@@ -10136,7 +10289,8 @@ PyObject* ast2obj_operator(struct ast_state *state, operator_ty o)
     }
     Py_UNREACHABLE();
 }
-PyObject* ast2obj_unaryop(struct ast_state *state, unaryop_ty o)
+PyObject* ast2obj_unaryop(struct ast_state *state, PyObject *Py_UNUSED(lazy),
+                          unaryop_ty o)
 {
     switch(o) {
         case Invert:
@@ -10150,7 +10304,8 @@ PyObject* ast2obj_unaryop(struct ast_state *state, unaryop_ty o)
     }
     Py_UNREACHABLE();
 }
-PyObject* ast2obj_cmpop(struct ast_state *state, cmpop_ty o)
+PyObject* ast2obj_cmpop(struct ast_state *state, PyObject *Py_UNUSED(lazy),
+                        cmpop_ty o)
 {
     switch(o) {
         case Eq:
@@ -10176,702 +10331,772 @@ PyObject* ast2obj_cmpop(struct ast_state *state, cmpop_ty o)
     }
     Py_UNREACHABLE();
 }
-PyObject*
-ast2obj_comprehension(struct ast_state *state, void* _o)
+static int
+ast2obj_comprehension_fields(struct ast_state *state, PyObject *lazy,
+                             PyObject *result, void* _o)
 {
     comprehension_ty o = (comprehension_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
-    if (!o) {
-        Py_RETURN_NONE;
-    }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
-    }
-    tp = (PyTypeObject *)state->comprehension_type;
-    result = PyType_GenericNew(tp, NULL, NULL);
-    if (!result) return NULL;
-    value = ast2obj_expr(state, o->target);
+    PyObject *value = NULL;
+    value = ast2obj_expr(state, lazy, o->target);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->target, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->target, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_expr(state, o->iter);
+    value = ast2obj_expr(state, lazy, o->iter);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->iter, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->iter, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_list(state, (asdl_seq*)o->ifs, ast2obj_expr);
+    value = ast2obj_list(state, lazy, (asdl_seq*)o->ifs, ast2obj_expr);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->ifs, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->ifs, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->is_async);
+    value = ast2obj_int(state, lazy, o->is_async);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->is_async, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->is_async, value) == -1)
         goto failed;
     Py_DECREF(value);
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
 }
 
 PyObject*
-ast2obj_excepthandler(struct ast_state *state, void* _o)
+ast2obj_comprehension(struct ast_state *state, PyObject *lazy, void* _o)
 {
-    excepthandler_ty o = (excepthandler_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
+    comprehension_ty o = (comprehension_ty)_o;
     if (!o) {
         Py_RETURN_NONE;
     }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
-    }
+    return ast2obj_node(state, lazy, state->comprehension_type, o,
+                        ast2obj_comprehension_fields);
+}
+
+static int
+ast2obj_excepthandler_fields(struct ast_state *state, PyObject *lazy,
+                             PyObject *result, void* _o)
+{
+    excepthandler_ty o = (excepthandler_ty)_o;
+    PyObject *value = NULL;
     switch (o->kind) {
     case ExceptHandler_kind:
-        tp = (PyTypeObject *)state->ExceptHandler_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.ExceptHandler.type);
+        value = ast2obj_expr(state, lazy, o->v.ExceptHandler.type);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->type, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->type, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_identifier(state, o->v.ExceptHandler.name);
+        value = ast2obj_identifier(state, lazy, o->v.ExceptHandler.name);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->name, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->name, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.ExceptHandler.body,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.ExceptHandler.body,
                              ast2obj_stmt);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->body, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->body, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     }
-    value = ast2obj_int(state, o->lineno);
+    value = ast2obj_int(state, lazy, o->lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->col_offset);
+    value = ast2obj_int(state, lazy, o->col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_lineno);
+    value = ast2obj_int(state, lazy, o->end_lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_col_offset);
+    value = ast2obj_int(state, lazy, o->end_col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
 }
 
 PyObject*
-ast2obj_arguments(struct ast_state *state, void* _o)
+ast2obj_excepthandler(struct ast_state *state, PyObject *lazy, void* _o)
 {
-    arguments_ty o = (arguments_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
+    excepthandler_ty o = (excepthandler_ty)_o;
     if (!o) {
         Py_RETURN_NONE;
     }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
+    PyObject *tp;
+    switch (o->kind) {
+    case ExceptHandler_kind:
+        tp = state->ExceptHandler_type;
+        break;
+    default:
+        Py_UNREACHABLE();
     }
-    tp = (PyTypeObject *)state->arguments_type;
-    result = PyType_GenericNew(tp, NULL, NULL);
-    if (!result) return NULL;
-    value = ast2obj_list(state, (asdl_seq*)o->posonlyargs, ast2obj_arg);
+    return ast2obj_node(state, lazy, tp, o, ast2obj_excepthandler_fields);
+}
+
+static int
+ast2obj_arguments_fields(struct ast_state *state, PyObject *lazy,
+                         PyObject *result, void* _o)
+{
+    arguments_ty o = (arguments_ty)_o;
+    PyObject *value = NULL;
+    value = ast2obj_list(state, lazy, (asdl_seq*)o->posonlyargs, ast2obj_arg);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->posonlyargs, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->posonlyargs, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_list(state, (asdl_seq*)o->args, ast2obj_arg);
+    value = ast2obj_list(state, lazy, (asdl_seq*)o->args, ast2obj_arg);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->args, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->args, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_arg(state, o->vararg);
+    value = ast2obj_arg(state, lazy, o->vararg);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->vararg, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->vararg, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_list(state, (asdl_seq*)o->kwonlyargs, ast2obj_arg);
+    value = ast2obj_list(state, lazy, (asdl_seq*)o->kwonlyargs, ast2obj_arg);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->kwonlyargs, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->kwonlyargs, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_list(state, (asdl_seq*)o->kw_defaults, ast2obj_expr);
+    value = ast2obj_list(state, lazy, (asdl_seq*)o->kw_defaults, ast2obj_expr);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->kw_defaults, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->kw_defaults, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_arg(state, o->kwarg);
+    value = ast2obj_arg(state, lazy, o->kwarg);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->kwarg, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->kwarg, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_list(state, (asdl_seq*)o->defaults, ast2obj_expr);
+    value = ast2obj_list(state, lazy, (asdl_seq*)o->defaults, ast2obj_expr);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->defaults, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->defaults, value) == -1)
         goto failed;
     Py_DECREF(value);
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
 }
 
 PyObject*
-ast2obj_arg(struct ast_state *state, void* _o)
+ast2obj_arguments(struct ast_state *state, PyObject *lazy, void* _o)
 {
-    arg_ty o = (arg_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
+    arguments_ty o = (arguments_ty)_o;
     if (!o) {
         Py_RETURN_NONE;
     }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
-    }
-    tp = (PyTypeObject *)state->arg_type;
-    result = PyType_GenericNew(tp, NULL, NULL);
-    if (!result) return NULL;
-    value = ast2obj_identifier(state, o->arg);
+    return ast2obj_node(state, lazy, state->arguments_type, o,
+                        ast2obj_arguments_fields);
+}
+
+static int
+ast2obj_arg_fields(struct ast_state *state, PyObject *lazy,
+                   PyObject *result, void* _o)
+{
+    arg_ty o = (arg_ty)_o;
+    PyObject *value = NULL;
+    value = ast2obj_identifier(state, lazy, o->arg);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->arg, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->arg, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_expr(state, o->annotation);
+    value = ast2obj_expr(state, lazy, o->annotation);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->annotation, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->annotation, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_string(state, o->type_comment);
+    value = ast2obj_string(state, lazy, o->type_comment);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->type_comment, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->type_comment, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->lineno);
+    value = ast2obj_int(state, lazy, o->lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->col_offset);
+    value = ast2obj_int(state, lazy, o->col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_lineno);
+    value = ast2obj_int(state, lazy, o->end_lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_col_offset);
+    value = ast2obj_int(state, lazy, o->end_col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
 }
 
 PyObject*
-ast2obj_keyword(struct ast_state *state, void* _o)
+ast2obj_arg(struct ast_state *state, PyObject *lazy, void* _o)
 {
-    keyword_ty o = (keyword_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
+    arg_ty o = (arg_ty)_o;
     if (!o) {
         Py_RETURN_NONE;
     }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
-    }
-    tp = (PyTypeObject *)state->keyword_type;
-    result = PyType_GenericNew(tp, NULL, NULL);
-    if (!result) return NULL;
-    value = ast2obj_identifier(state, o->arg);
+    return ast2obj_node(state, lazy, state->arg_type, o, ast2obj_arg_fields);
+}
+
+static int
+ast2obj_keyword_fields(struct ast_state *state, PyObject *lazy,
+                       PyObject *result, void* _o)
+{
+    keyword_ty o = (keyword_ty)_o;
+    PyObject *value = NULL;
+    value = ast2obj_identifier(state, lazy, o->arg);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->arg, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->arg, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_expr(state, o->value);
+    value = ast2obj_expr(state, lazy, o->value);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->value, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->value, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->lineno);
+    value = ast2obj_int(state, lazy, o->lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->col_offset);
+    value = ast2obj_int(state, lazy, o->col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_lineno);
+    value = ast2obj_int(state, lazy, o->end_lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_col_offset);
+    value = ast2obj_int(state, lazy, o->end_col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
 }
 
 PyObject*
-ast2obj_alias(struct ast_state *state, void* _o)
+ast2obj_keyword(struct ast_state *state, PyObject *lazy, void* _o)
 {
-    alias_ty o = (alias_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
+    keyword_ty o = (keyword_ty)_o;
     if (!o) {
         Py_RETURN_NONE;
     }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
-    }
-    tp = (PyTypeObject *)state->alias_type;
-    result = PyType_GenericNew(tp, NULL, NULL);
-    if (!result) return NULL;
-    value = ast2obj_identifier(state, o->name);
+    return ast2obj_node(state, lazy, state->keyword_type, o,
+                        ast2obj_keyword_fields);
+}
+
+static int
+ast2obj_alias_fields(struct ast_state *state, PyObject *lazy,
+                     PyObject *result, void* _o)
+{
+    alias_ty o = (alias_ty)_o;
+    PyObject *value = NULL;
+    value = ast2obj_identifier(state, lazy, o->name);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->name, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->name, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_identifier(state, o->asname);
+    value = ast2obj_identifier(state, lazy, o->asname);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->asname, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->asname, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->lineno);
+    value = ast2obj_int(state, lazy, o->lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->col_offset);
+    value = ast2obj_int(state, lazy, o->col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_lineno);
+    value = ast2obj_int(state, lazy, o->end_lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_col_offset);
+    value = ast2obj_int(state, lazy, o->end_col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
 }
 
 PyObject*
-ast2obj_withitem(struct ast_state *state, void* _o)
+ast2obj_alias(struct ast_state *state, PyObject *lazy, void* _o)
 {
-    withitem_ty o = (withitem_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
+    alias_ty o = (alias_ty)_o;
     if (!o) {
         Py_RETURN_NONE;
     }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
-    }
-    tp = (PyTypeObject *)state->withitem_type;
-    result = PyType_GenericNew(tp, NULL, NULL);
-    if (!result) return NULL;
-    value = ast2obj_expr(state, o->context_expr);
+    return ast2obj_node(state, lazy, state->alias_type, o,
+                        ast2obj_alias_fields);
+}
+
+static int
+ast2obj_withitem_fields(struct ast_state *state, PyObject *lazy,
+                        PyObject *result, void* _o)
+{
+    withitem_ty o = (withitem_ty)_o;
+    PyObject *value = NULL;
+    value = ast2obj_expr(state, lazy, o->context_expr);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->context_expr, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->context_expr, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_expr(state, o->optional_vars);
+    value = ast2obj_expr(state, lazy, o->optional_vars);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->optional_vars, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->optional_vars, value) == -1)
         goto failed;
     Py_DECREF(value);
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
 }
 
 PyObject*
-ast2obj_match_case(struct ast_state *state, void* _o)
+ast2obj_withitem(struct ast_state *state, PyObject *lazy, void* _o)
 {
-    match_case_ty o = (match_case_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
+    withitem_ty o = (withitem_ty)_o;
     if (!o) {
         Py_RETURN_NONE;
     }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
-    }
-    tp = (PyTypeObject *)state->match_case_type;
-    result = PyType_GenericNew(tp, NULL, NULL);
-    if (!result) return NULL;
-    value = ast2obj_pattern(state, o->pattern);
+    return ast2obj_node(state, lazy, state->withitem_type, o,
+                        ast2obj_withitem_fields);
+}
+
+static int
+ast2obj_match_case_fields(struct ast_state *state, PyObject *lazy,
+                          PyObject *result, void* _o)
+{
+    match_case_ty o = (match_case_ty)_o;
+    PyObject *value = NULL;
+    value = ast2obj_pattern(state, lazy, o->pattern);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->pattern, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->pattern, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_expr(state, o->guard);
+    value = ast2obj_expr(state, lazy, o->guard);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->guard, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->guard, value) == -1)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_list(state, (asdl_seq*)o->body, ast2obj_stmt);
+    value = ast2obj_list(state, lazy, (asdl_seq*)o->body, ast2obj_stmt);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->body, value) == -1)
+    if (PyObject_GenericSetAttr(result, state->body, value) == -1)
         goto failed;
     Py_DECREF(value);
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
 }
 
 PyObject*
-ast2obj_pattern(struct ast_state *state, void* _o)
+ast2obj_match_case(struct ast_state *state, PyObject *lazy, void* _o)
 {
-    pattern_ty o = (pattern_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
+    match_case_ty o = (match_case_ty)_o;
     if (!o) {
         Py_RETURN_NONE;
     }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
-    }
+    return ast2obj_node(state, lazy, state->match_case_type, o,
+                        ast2obj_match_case_fields);
+}
+
+static int
+ast2obj_pattern_fields(struct ast_state *state, PyObject *lazy,
+                       PyObject *result, void* _o)
+{
+    pattern_ty o = (pattern_ty)_o;
+    PyObject *value = NULL;
     switch (o->kind) {
     case MatchValue_kind:
-        tp = (PyTypeObject *)state->MatchValue_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.MatchValue.value);
+        value = ast2obj_expr(state, lazy, o->v.MatchValue.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case MatchSingleton_kind:
-        tp = (PyTypeObject *)state->MatchSingleton_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_constant(state, o->v.MatchSingleton.value);
+        value = ast2obj_constant(state, lazy, o->v.MatchSingleton.value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->value, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case MatchSequence_kind:
-        tp = (PyTypeObject *)state->MatchSequence_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.MatchSequence.patterns,
+        value = ast2obj_list(state, lazy,
+                             (asdl_seq*)o->v.MatchSequence.patterns,
                              ast2obj_pattern);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->patterns, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->patterns, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case MatchMapping_kind:
-        tp = (PyTypeObject *)state->MatchMapping_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.MatchMapping.keys,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.MatchMapping.keys,
                              ast2obj_expr);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->keys, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->keys, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.MatchMapping.patterns,
+        value = ast2obj_list(state, lazy,
+                             (asdl_seq*)o->v.MatchMapping.patterns,
                              ast2obj_pattern);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->patterns, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->patterns, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_identifier(state, o->v.MatchMapping.rest);
+        value = ast2obj_identifier(state, lazy, o->v.MatchMapping.rest);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->rest, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->rest, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case MatchClass_kind:
-        tp = (PyTypeObject *)state->MatchClass_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_expr(state, o->v.MatchClass.cls);
+        value = ast2obj_expr(state, lazy, o->v.MatchClass.cls);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->cls, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->cls, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.MatchClass.patterns,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.MatchClass.patterns,
                              ast2obj_pattern);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->patterns, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->patterns, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.MatchClass.kwd_attrs,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.MatchClass.kwd_attrs,
                              ast2obj_identifier);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->kwd_attrs, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->kwd_attrs, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_list(state, (asdl_seq*)o->v.MatchClass.kwd_patterns,
+        value = ast2obj_list(state, lazy,
+                             (asdl_seq*)o->v.MatchClass.kwd_patterns,
                              ast2obj_pattern);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->kwd_patterns, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->kwd_patterns, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case MatchStar_kind:
-        tp = (PyTypeObject *)state->MatchStar_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_identifier(state, o->v.MatchStar.name);
+        value = ast2obj_identifier(state, lazy, o->v.MatchStar.name);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->name, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->name, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case MatchAs_kind:
-        tp = (PyTypeObject *)state->MatchAs_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_pattern(state, o->v.MatchAs.pattern);
+        value = ast2obj_pattern(state, lazy, o->v.MatchAs.pattern);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->pattern, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->pattern, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_identifier(state, o->v.MatchAs.name);
+        value = ast2obj_identifier(state, lazy, o->v.MatchAs.name);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->name, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->name, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case MatchOr_kind:
-        tp = (PyTypeObject *)state->MatchOr_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_list(state, (asdl_seq*)o->v.MatchOr.patterns,
+        value = ast2obj_list(state, lazy, (asdl_seq*)o->v.MatchOr.patterns,
                              ast2obj_pattern);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->patterns, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->patterns, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     }
-    value = ast2obj_int(state, o->lineno);
+    value = ast2obj_int(state, lazy, o->lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->col_offset);
+    value = ast2obj_int(state, lazy, o->col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_lineno);
+    value = ast2obj_int(state, lazy, o->end_lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_col_offset);
+    value = ast2obj_int(state, lazy, o->end_col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
 }
 
 PyObject*
-ast2obj_type_ignore(struct ast_state *state, void* _o)
+ast2obj_pattern(struct ast_state *state, PyObject *lazy, void* _o)
 {
-    type_ignore_ty o = (type_ignore_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
+    pattern_ty o = (pattern_ty)_o;
     if (!o) {
         Py_RETURN_NONE;
     }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
+    PyObject *tp;
+    switch (o->kind) {
+    case MatchValue_kind:
+        tp = state->MatchValue_type;
+        break;
+    case MatchSingleton_kind:
+        tp = state->MatchSingleton_type;
+        break;
+    case MatchSequence_kind:
+        tp = state->MatchSequence_type;
+        break;
+    case MatchMapping_kind:
+        tp = state->MatchMapping_type;
+        break;
+    case MatchClass_kind:
+        tp = state->MatchClass_type;
+        break;
+    case MatchStar_kind:
+        tp = state->MatchStar_type;
+        break;
+    case MatchAs_kind:
+        tp = state->MatchAs_type;
+        break;
+    case MatchOr_kind:
+        tp = state->MatchOr_type;
+        break;
+    default:
+        Py_UNREACHABLE();
     }
+    return ast2obj_node(state, lazy, tp, o, ast2obj_pattern_fields);
+}
+
+static int
+ast2obj_type_ignore_fields(struct ast_state *state, PyObject *lazy,
+                           PyObject *result, void* _o)
+{
+    type_ignore_ty o = (type_ignore_ty)_o;
+    PyObject *value = NULL;
     switch (o->kind) {
     case TypeIgnore_kind:
-        tp = (PyTypeObject *)state->TypeIgnore_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_int(state, o->v.TypeIgnore.lineno);
+        value = ast2obj_int(state, lazy, o->v.TypeIgnore.lineno);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->lineno, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->lineno, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_string(state, o->v.TypeIgnore.tag);
+        value = ast2obj_string(state, lazy, o->v.TypeIgnore.tag);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->tag, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->tag, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     }
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
 }
 
 PyObject*
-ast2obj_type_param(struct ast_state *state, void* _o)
+ast2obj_type_ignore(struct ast_state *state, PyObject *lazy, void* _o)
 {
-    type_param_ty o = (type_param_ty)_o;
-    PyObject *result = NULL, *value = NULL;
-    PyTypeObject *tp;
+    type_ignore_ty o = (type_ignore_ty)_o;
     if (!o) {
         Py_RETURN_NONE;
     }
-    if (Py_EnterRecursiveCall("during  ast construction")) {
-        return NULL;
+    PyObject *tp;
+    switch (o->kind) {
+    case TypeIgnore_kind:
+        tp = state->TypeIgnore_type;
+        break;
+    default:
+        Py_UNREACHABLE();
     }
+    return ast2obj_node(state, lazy, tp, o, ast2obj_type_ignore_fields);
+}
+
+static int
+ast2obj_type_param_fields(struct ast_state *state, PyObject *lazy,
+                          PyObject *result, void* _o)
+{
+    type_param_ty o = (type_param_ty)_o;
+    PyObject *value = NULL;
     switch (o->kind) {
     case TypeVar_kind:
-        tp = (PyTypeObject *)state->TypeVar_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_identifier(state, o->v.TypeVar.name);
+        value = ast2obj_identifier(state, lazy, o->v.TypeVar.name);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->name, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->name, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.TypeVar.bound);
+        value = ast2obj_expr(state, lazy, o->v.TypeVar.bound);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->bound, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->bound, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.TypeVar.default_value);
+        value = ast2obj_expr(state, lazy, o->v.TypeVar.default_value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->default_value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->default_value, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case ParamSpec_kind:
-        tp = (PyTypeObject *)state->ParamSpec_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_identifier(state, o->v.ParamSpec.name);
+        value = ast2obj_identifier(state, lazy, o->v.ParamSpec.name);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->name, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->name, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.ParamSpec.default_value);
+        value = ast2obj_expr(state, lazy, o->v.ParamSpec.default_value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->default_value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->default_value, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     case TypeVarTuple_kind:
-        tp = (PyTypeObject *)state->TypeVarTuple_type;
-        result = PyType_GenericNew(tp, NULL, NULL);
-        if (!result) goto failed;
-        value = ast2obj_identifier(state, o->v.TypeVarTuple.name);
+        value = ast2obj_identifier(state, lazy, o->v.TypeVarTuple.name);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->name, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->name, value) == -1)
             goto failed;
         Py_DECREF(value);
-        value = ast2obj_expr(state, o->v.TypeVarTuple.default_value);
+        value = ast2obj_expr(state, lazy, o->v.TypeVarTuple.default_value);
         if (!value) goto failed;
-        if (PyObject_SetAttr(result, state->default_value, value) == -1)
+        if (PyObject_GenericSetAttr(result, state->default_value, value) == -1)
             goto failed;
         Py_DECREF(value);
         break;
     }
-    value = ast2obj_int(state, o->lineno);
+    value = ast2obj_int(state, lazy, o->lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->col_offset);
+    value = ast2obj_int(state, lazy, o->col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_lineno);
+    value = ast2obj_int(state, lazy, o->end_lineno);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_lineno, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_lineno, value) < 0)
         goto failed;
     Py_DECREF(value);
-    value = ast2obj_int(state, o->end_col_offset);
+    value = ast2obj_int(state, lazy, o->end_col_offset);
     if (!value) goto failed;
-    if (PyObject_SetAttr(result, state->end_col_offset, value) < 0)
+    if (PyObject_GenericSetAttr(result, state->end_col_offset, value) < 0)
         goto failed;
     Py_DECREF(value);
-    Py_LeaveRecursiveCall();
-    return result;
+    return 0;
 failed:
-    Py_LeaveRecursiveCall();
     Py_XDECREF(value);
-    Py_XDECREF(result);
-    return NULL;
+    return -1;
+}
+
+PyObject*
+ast2obj_type_param(struct ast_state *state, PyObject *lazy, void* _o)
+{
+    type_param_ty o = (type_param_ty)_o;
+    if (!o) {
+        Py_RETURN_NONE;
+    }
+    PyObject *tp;
+    switch (o->kind) {
+    case TypeVar_kind:
+        tp = state->TypeVar_type;
+        break;
+    case ParamSpec_kind:
+        tp = state->ParamSpec_type;
+        break;
+    case TypeVarTuple_kind:
+        tp = state->TypeVarTuple_type;
+        break;
+    default:
+        Py_UNREACHABLE();
+    }
+    return ast2obj_node(state, lazy, tp, o, ast2obj_type_param_fields);
+}
+
+static int
+ast2obj_lazy_fields(struct ast_state *state, PyObject *lazy,
+                    PyObject *result, void *node)
+{
+    PyObject *tp = (PyObject *)Py_TYPE(result);
+    PyObject *base = (PyObject *)Py_TYPE(result)->tp_base;
+    if (base == state->mod_type) {
+        return ast2obj_mod_fields(state, lazy, result, node);
+    }
+    if (base == state->stmt_type) {
+        return ast2obj_stmt_fields(state, lazy, result, node);
+    }
+    if (base == state->expr_type) {
+        return ast2obj_expr_fields(state, lazy, result, node);
+    }
+    if (tp == state->comprehension_type) {
+        return ast2obj_comprehension_fields(state, lazy, result, node);
+    }
+    if (base == state->excepthandler_type) {
+        return ast2obj_excepthandler_fields(state, lazy, result, node);
+    }
+    if (tp == state->arguments_type) {
+        return ast2obj_arguments_fields(state, lazy, result, node);
+    }
+    if (tp == state->arg_type) {
+        return ast2obj_arg_fields(state, lazy, result, node);
+    }
+    if (tp == state->keyword_type) {
+        return ast2obj_keyword_fields(state, lazy, result, node);
+    }
+    if (tp == state->alias_type) {
+        return ast2obj_alias_fields(state, lazy, result, node);
+    }
+    if (tp == state->withitem_type) {
+        return ast2obj_withitem_fields(state, lazy, result, node);
+    }
+    if (tp == state->match_case_type) {
+        return ast2obj_match_case_fields(state, lazy, result, node);
+    }
+    if (base == state->pattern_type) {
+        return ast2obj_pattern_fields(state, lazy, result, node);
+    }
+    if (base == state->type_ignore_type) {
+        return ast2obj_type_ignore_fields(state, lazy, result, node);
+    }
+    if (base == state->type_param_type) {
+        return ast2obj_type_param_fields(state, lazy, result, node);
+    }
+    Py_UNREACHABLE();
 }
 
 
@@ -17999,6 +18224,9 @@ astmodule_exec(PyObject *m)
     if (PyModule_AddIntMacro(m, PyCF_OPTIMIZED_AST) < 0) {
         return -1;
     }
+    if (PyModule_AddIntMacro(m, PyCF_LAZY_AST) < 0) {
+        return -1;
+    }
     if (PyModule_AddObjectRef(m, "mod", state->mod_type) < 0) {
         return -1;
     }
@@ -18418,8 +18646,33 @@ PyObject* PyAST_mod2obj(mod_ty t)
     if (state == NULL) {
         return NULL;
     }
-    PyObject *result = ast2obj_mod(state, t);
+    PyObject *result = ast2obj_mod(state, NULL, t);
+
+    return result;
+}
+
+static void
+ast_arena_destructor(PyObject *capsule)
+{
+    _PyArena_Free(PyCapsule_GetPointer(capsule, NULL));
+}
 
+/* Like PyAST_mod2obj(), but the fields of each node are converted on first
+   access.  Take ownership of arena, which is freed once no node needs it. */
+PyObject* PyAST_mod2obj_lazy(mod_ty t, PyArena *arena)
+{
+    struct ast_state *state = get_ast_state();
+    if (state == NULL) {
+        _PyArena_Free(arena);
+        return NULL;
+    }
+    PyObject *owner = PyCapsule_New(arena, NULL, ast_arena_destructor);
+    if (owner == NULL) {
+        _PyArena_Free(arena);
+        return NULL;
+    }
+    PyObject *result = ast2obj_mod(state, owner, t);
+    Py_DECREF(owner);
     return result;
 }
 
@@ -861,6 +861,11 @@ builtin_compile_impl(PyObject *module, PyObject *source, PyObject *filename,
                 _PyArena_Free(arena);
                 goto error;
             }
+            if ((flags & PyCF_LAZY_AST) == PyCF_LAZY_AST) {
+                /* The nodes keep the arena alive until they are converted. */
+                result = PyAST_mod2obj_lazy(mod, arena);
+                goto finally;
+            }
             result = PyAST_mod2obj(mod);
         }
         else {
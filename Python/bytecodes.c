@@ -589,6 +589,8 @@ dummy_func(
             BINARY_OP_SUBSCR_DICT,
             BINARY_OP_SUBSCR_GETITEM,
             // BINARY_OP_INPLACE_ADD_UNICODE,  // See comments at that opcode.
+            // BINARY_OP_INPLACE_ADD_INT,
+            // BINARY_OP_INPLACE_SUBTRACT_INT,
             BINARY_OP_EXTEND,
         };
 
@@ -659,6 +661,79 @@ dummy_func(
             INPUTS_DEAD();
         }
 
+        // Super-instructions for BINARY_OP_ADD_INT and BINARY_OP_SUBTRACT_INT
+        // followed by a STORE_FAST into the left argument, in the same way
+        // as BINARY_OP_INPLACE_ADD_UNICODE.  They keep counter loops
+        // (`i += 1`, `n -= 1`) from allocating a new int per iteration:
+        // once the stack reference to `left` is dropped, the local holds
+        // the only reference unless the int has escaped, and the result
+        // is then written into it in place.
+        op(_BINARY_OP_INPLACE_ADD_INT, (left, right --)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            assert(_PyLong_BothAreCompact((PyLongObject *)left_o, (PyLongObject *)right_o));
+
+            int next_oparg;
+        #if TIER_ONE
+            assert(next_instr->op.code == STORE_FAST);
+            next_oparg = next_instr->op.arg;
+        #else
+            next_oparg = (int)CURRENT_OPERAND0();
+        #endif
+            _PyStackRef *target_local = &GETLOCAL(next_oparg);
+            DEOPT_IF(PyStackRef_AsPyObjectBorrow(*target_local) != left_o);
+            Py_ssize_t value = _PyLong_CompactValue((PyLongObject *)left_o)
+                             + _PyLong_CompactValue((PyLongObject *)right_o);
+            DEOPT_IF(!_PyLong_IsCompactValue(value));
+            STAT_INC(BINARY_OP, hit);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            INPUTS_DEAD();
+            PyObject *temp = PyStackRef_AsPyObjectSteal(*target_local);
+            _PyCompactLong_InplaceStore(&temp, value);
+            *target_local = PyStackRef_FromPyObjectSteal(temp);
+            ERROR_IF(PyStackRef_IsNull(*target_local));
+        #if TIER_ONE
+            assert(next_instr->op.code == STORE_FAST);
+            SKIP_OVER(1);
+        #endif
+        }
+
+        op(_BINARY_OP_INPLACE_SUBTRACT_INT, (left, right --)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            assert(_PyLong_BothAreCompact((PyLongObject *)left_o, (PyLongObject *)right_o));
+
+            int next_oparg;
+        #if TIER_ONE
+            assert(next_instr->op.code == STORE_FAST);
+            next_oparg = next_instr->op.arg;
+        #else
+            next_oparg = (int)CURRENT_OPERAND0();
+        #endif
+            _PyStackRef *target_local = &GETLOCAL(next_oparg);
+            DEOPT_IF(PyStackRef_AsPyObjectBorrow(*target_local) != left_o);
+            Py_ssize_t value = _PyLong_CompactValue((PyLongObject *)left_o)
+                             - _PyLong_CompactValue((PyLongObject *)right_o);
+            DEOPT_IF(!_PyLong_IsCompactValue(value));
+            STAT_INC(BINARY_OP, hit);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            INPUTS_DEAD();
+            PyObject *temp = PyStackRef_AsPyObjectSteal(*target_local);
+            _PyCompactLong_InplaceStore(&temp, value);
+            *target_local = PyStackRef_FromPyObjectSteal(temp);
+            ERROR_IF(PyStackRef_IsNull(*target_local));
+        #if TIER_ONE
+            assert(next_instr->op.code == STORE_FAST);
+            SKIP_OVER(1);
+        #endif
+        }
+
         macro(BINARY_OP_MULTIPLY_INT) =
             _GUARD_TOS_INT + _GUARD_NOS_INT + unused/5 + _BINARY_OP_MULTIPLY_INT;
 
@@ -668,6 +743,12 @@ dummy_func(
         macro(BINARY_OP_SUBTRACT_INT) =
             _GUARD_TOS_INT + _GUARD_NOS_INT + unused/5 + _BINARY_OP_SUBTRACT_INT;
 
+        macro(BINARY_OP_INPLACE_ADD_INT) =
+            _GUARD_TOS_INT + _GUARD_NOS_INT + unused/5 + _BINARY_OP_INPLACE_ADD_INT;
+
+        macro(BINARY_OP_INPLACE_SUBTRACT_INT) =
+            _GUARD_TOS_INT + _GUARD_NOS_INT + unused/5 + _BINARY_OP_INPLACE_SUBTRACT_INT;
+
         op(_GUARD_NOS_FLOAT, (left, unused -- left, unused)) {
             PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
             EXIT_IF(!PyFloat_CheckExact(left_o));
@@ -5605,7 +5686,9 @@ dummy_func(
             _PyThreadStateImpl *_tstate = (_PyThreadStateImpl *)tstate;
             if ((_tstate->jit_tracer_state.prev_state.instr->op.code == CALL_LIST_APPEND &&
                 opcode == POP_TOP) ||
-                (_tstate->jit_tracer_state.prev_state.instr->op.code == BINARY_OP_INPLACE_ADD_UNICODE &&
+                ((_tstate->jit_tracer_state.prev_state.instr->op.code == BINARY_OP_INPLACE_ADD_UNICODE ||
+                  _tstate->jit_tracer_state.prev_state.instr->op.code == BINARY_OP_INPLACE_ADD_INT ||
+                  _tstate->jit_tracer_state.prev_state.instr->op.code == BINARY_OP_INPLACE_SUBTRACT_INT) &&
                 opcode == STORE_FAST)) {
                 _tstate->jit_tracer_state.prev_state.instr_is_super = true;
             }
@@ -1820,6 +1820,27 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(sys__get_stop_the_world_stats__doc__,
+"_get_stop_the_world_stats($module, /)\n"
+"--\n"
+"\n"
+"Return statistics on the stop-the-world pauses of the interpreter.\n"
+"\n"
+"The \"global\" key holds the statistics on the pauses of all interpreters.\n"
+"Durations are in seconds.  On builds with the GIL, all values are zero.");
+
+#define SYS__GET_STOP_THE_WORLD_STATS_METHODDEF    \
+    {"_get_stop_the_world_stats", (PyCFunction)sys__get_stop_the_world_stats, METH_NOARGS, sys__get_stop_the_world_stats__doc__},
+
+static PyObject *
+sys__get_stop_the_world_stats_impl(PyObject *module);
+
+static PyObject *
+sys__get_stop_the_world_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__get_stop_the_world_stats_impl(module);
+}
+
 PyDoc_STRVAR(_jit_is_available__doc__,
 "is_available($module, /)\n"
 "--\n"
@@ -1947,4 +1968,4 @@ exit:
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=5f7d84c5bf00d557 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=0518362a708bc601 input=a9049054013a1b77]*/
@@ -6345,6 +6345,168 @@ codegen_pattern(compiler *c, pattern_ty p, pattern_context *pc)
     return _PyCompile_Error(c, LOC(p), e, p->kind);
 }
 
+/* Minimum number of consecutive cases compiled to a dispatch table. */
+#define MATCH_DISPATCH_MIN_CASES 12
+
+// Return the literal matched by a value pattern if it can be looked up in a
+// dispatch table, or NULL.  Set *text to 1 for str and 2 for bytes.
+static PyObject *
+match_dispatch_value(pattern_ty p, int *text)
+{
+    if (p->kind != MatchValue_kind ||
+        p->v.MatchValue.value->kind != Constant_kind)
+    {
+        return NULL;
+    }
+    PyObject *value = p->v.MatchValue.value->v.Constant.value;
+    *text = 0;
+    if (PyLong_CheckExact(value)) {
+        return value;
+    }
+    if (PyFloat_CheckExact(value)) {
+        return Py_IS_NAN(PyFloat_AS_DOUBLE(value)) ? NULL : value;
+    }
+    if (PyComplex_CheckExact(value)) {
+        Py_complex z = PyComplex_AsCComplex(value);
+        return Py_IS_NAN(z.real) || Py_IS_NAN(z.imag) ? NULL : value;
+    }
+    if (PyUnicode_CheckExact(value)) {
+        *text = 1;
+        return value;
+    }
+    if (PyBytes_CheckExact(value)) {
+        *text = 2;
+        return value;
+    }
+    return NULL;
+}
+
+// Find the run of unguarded cases from start which only match literals
+// (alone or in an or-pattern), and add a (value, index) pair for each
+// literal to the list pairs.  Return the index of the first case after
+// the run.  str and bytes literals are never mixed, so that building the
+// table never compares them.
+static Py_ssize_t
+match_dispatch_run(asdl_match_case_seq *cases, Py_ssize_t start,
+                   Py_ssize_t stop, PyObject *pairs)
+{
+    int run_text = 0;
+    for (Py_ssize_t i = start; i < stop; i++) {
+        match_case_ty m = asdl_seq_GET(cases, i);
+        if (m->guard) {
+            return i;
+        }
+        asdl_pattern_seq *alts = NULL;
+        Py_ssize_t nalts = 1;
+        if (m->pattern->kind == MatchOr_kind) {
+            alts = m->pattern->v.MatchOr.patterns;
+            nalts = asdl_seq_LEN(alts);
+        }
+        for (Py_ssize_t j = 0; j < nalts; j++) {
+            pattern_ty p = alts ? asdl_seq_GET(alts, j) : m->pattern;
+            int text;
+            if (match_dispatch_value(p, &text) == NULL ||
+                (text && run_text && text != run_text))
+            {
+                return i;
+            }
+            run_text = text ? text : run_text;
+        }
+        for (Py_ssize_t j = 0; j < nalts; j++) {
+            pattern_ty p = alts ? asdl_seq_GET(alts, j) : m->pattern;
+            int text;
+            PyObject *pair = Py_BuildValue("(On)", match_dispatch_value(p, &text),
+                                           i - start);
+            if (pair == NULL || PyList_Append(pairs, pair) < 0) {
+                Py_XDECREF(pair);
+                return -1;
+            }
+            Py_DECREF(pair);
+        }
+    }
+    return stop;
+}
+
+// Jump to labels[index] for the case index on top of the stack, which is
+// in [lo, hi).  labels[-1] is the label for no match.
+static int
+codegen_match_dispatch_search(compiler *c, location loc,
+                              jump_target_label *labels,
+                              Py_ssize_t lo, Py_ssize_t hi)
+{
+    if (hi - lo == 1) {
+        ADDOP_JUMP(c, loc, JUMP, labels[lo]);
+        return SUCCESS;
+    }
+    Py_ssize_t mid = lo + (hi - lo) / 2;
+    NEW_JUMP_TARGET_LABEL(c, lower);
+    ADDOP_I(c, loc, COPY, 1);
+    ADDOP_LOAD_CONST_NEW(c, loc, PyLong_FromSsize_t(mid));
+    ADDOP_COMPARE(c, loc, Lt);
+    ADDOP(c, loc, TO_BOOL);
+    ADDOP_JUMP(c, loc, POP_JUMP_IF_TRUE, lower);
+    RETURN_IF_ERROR(codegen_match_dispatch_search(c, loc, labels, mid, hi));
+    USE_LABEL(c, lower);
+    return codegen_match_dispatch_search(c, loc, labels, lo, mid);
+}
+
+static int
+codegen_match_dispatch_cases(compiler *c, asdl_match_case_seq *cases,
+                             Py_ssize_t start, Py_ssize_t stop,
+                             jump_target_label *labels, int last,
+                             jump_target_label end)
+{
+    match_case_ty m = asdl_seq_GET(cases, start);
+    location loc = LOC(m->pattern);
+    Py_ssize_t n = stop - start;
+    for (Py_ssize_t i = 0; i <= n; i++) {
+        labels[i] = _PyInstructionSequence_NewLabel(INSTR_SEQUENCE(c));
+        if (!IS_JUMP_TARGET_LABEL(labels[i])) {
+            return ERROR;
+        }
+    }
+    RETURN_IF_ERROR(codegen_match_dispatch_search(c, loc, labels + 1, -1, n));
+    for (Py_ssize_t i = 0; i < n; i++) {
+        m = asdl_seq_GET(cases, start + i);
+        USE_LABEL(c, labels[i + 1]);
+        // It's a match! Pop the index and the subject:
+        ADDOP(c, LOC(m->pattern), POP_TOP);
+        ADDOP(c, NEXT_LOCATION, POP_TOP);
+        VISIT_SEQ(c, stmt, m->body);
+        ADDOP_JUMP(c, NO_LOCATION, JUMP, end);
+    }
+    USE_LABEL(c, labels[0]);
+    ADDOP(c, loc, POP_TOP);
+    if (last) {
+        ADDOP(c, loc, POP_TOP);
+    }
+    return SUCCESS;
+}
+
+// Compile the cases [start, stop), which only match literals, to a lookup
+// of the subject in a table of the literals followed by a binary search for
+// the index of the matching case.  Consume the subject if last is true and
+// none of the cases match.
+static int
+codegen_match_dispatch(compiler *c, asdl_match_case_seq *cases,
+                       Py_ssize_t start, Py_ssize_t stop, PyObject *pairs,
+                       int last, jump_target_label end)
+{
+    location loc = LOC(((match_case_ty)asdl_seq_GET(cases, start))->pattern);
+    ADDOP_I(c, loc, COPY, 1);
+    ADDOP_LOAD_CONST_NEW(c, loc, PyList_AsTuple(pairs));
+    ADDOP_I(c, loc, CALL_INTRINSIC_2, INTRINSIC_MATCH_VALUE_DISPATCH);
+    jump_target_label *labels = PyMem_New(jump_target_label, stop - start + 1);
+    if (labels == NULL) {
+        PyErr_NoMemory();
+        return ERROR;
+    }
+    int res = codegen_match_dispatch_cases(c, cases, start, stop, labels,
+                                           last, end);
+    PyMem_Free(labels);
+    return res;
+}
+
 static int
 codegen_match_inner(compiler *c, stmt_ty s, pattern_context *pc)
 {
@@ -6354,7 +6516,30 @@ codegen_match_inner(compiler *c, stmt_ty s, pattern_context *pc)
     assert(cases > 0);
     match_case_ty m = asdl_seq_GET(s->v.Match.cases, cases - 1);
     int has_default = WILDCARD_CHECK(m->pattern) && 1 < cases;
+    // Cases before this index can't start a run of literal patterns:
+    Py_ssize_t dispatch_checked = 0;
     for (Py_ssize_t i = 0; i < cases - has_default; i++) {
+        if (i >= dispatch_checked) {
+            PyObject *pairs = PyList_New(0);
+            if (pairs == NULL) {
+                return ERROR;
+            }
+            Py_ssize_t stop = match_dispatch_run(s->v.Match.cases, i,
+                                                 cases - has_default, pairs);
+            if (stop >= 0 && stop - i >= MATCH_DISPATCH_MIN_CASES) {
+                int res = codegen_match_dispatch(c, s->v.Match.cases, i, stop,
+                                                 pairs,
+                                                 stop == cases - has_default,
+                                                 end);
+                Py_DECREF(pairs);
+                RETURN_IF_ERROR(res);
+                i = stop - 1;
+                continue;
+            }
+            Py_DECREF(pairs);
+            RETURN_IF_ERROR(stop);
+            dispatch_checked = Py_MAX(stop, i + 1);
+        }
         m = asdl_seq_GET(s->v.Match.cases, i);
         // Only copy the subject if we're *not* on the last case:
         if (i != cases - has_default - 1) {
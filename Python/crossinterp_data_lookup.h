@@ -476,15 +476,45 @@ _PyBytes_GetXIDataWrapped(PyThreadState *tstate,
 
 struct _shared_str_data {
     int kind;
+    int ascii;
     const void *buffer;
     Py_ssize_t len;
+    Py_hash_t hash;
 };
 
 static PyObject *
 _new_str_object(_PyXIData_t *xidata)
 {
     struct _shared_str_data *shared = (struct _shared_str_data *)(xidata->data);
-    return PyUnicode_FromKindAndData(shared->kind, shared->buffer, shared->len);
+    if (shared->len <= 1) {
+        // Use the singletons.
+        return PyUnicode_FromKindAndData(shared->kind, shared->buffer,
+                                         shared->len);
+    }
+    // The original string is in canonical form, so we can copy its buffer
+    // as-is, rather than scan it for its widest character.
+    Py_UCS4 maxchar;
+    switch (shared->kind) {
+    case PyUnicode_1BYTE_KIND:
+        maxchar = shared->ascii ? 0x7f : 0xff;
+        break;
+    case PyUnicode_2BYTE_KIND:
+        maxchar = 0xffff;
+        break;
+    default:
+        assert(shared->kind == PyUnicode_4BYTE_KIND);
+        maxchar = _Py_MAX_UNICODE;
+    }
+    PyObject *str = PyUnicode_New(shared->len, maxchar);
+    if (str == NULL) {
+        return NULL;
+    }
+    assert(PyUnicode_KIND(str) == shared->kind);
+    memcpy(PyUnicode_DATA(str), shared->buffer,
+           (size_t)shared->len * shared->kind);
+    // The hash does not depend on the interpreter, so we reuse it.
+    _PyASCIIObject_CAST(str)->hash = shared->hash;
+    return str;
 }
 
 static int
@@ -499,8 +529,10 @@ _str_shared(PyThreadState *tstate, PyObject *obj, _PyXIData_t *xidata)
     }
     struct _shared_str_data *shared = (struct _shared_str_data *)xidata->data;
     shared->kind = PyUnicode_KIND(obj);
+    shared->ascii = PyUnicode_IS_ASCII(obj);
     shared->buffer = PyUnicode_DATA(obj);
     shared->len = PyUnicode_GET_LENGTH(obj);
+    shared->hash = PyUnstable_Unicode_GET_CACHED_HASH(obj);
     return 0;
 }
 
@@ -1003,6 +1003,102 @@
             break;
         }
 
+        case _BINARY_OP_INPLACE_ADD_INT: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            assert(_PyLong_BothAreCompact((PyLongObject *)left_o, (PyLongObject *)right_o));
+            int next_oparg;
+            #if TIER_ONE
+            assert(next_instr->op.code == STORE_FAST);
+            next_oparg = next_instr->op.arg;
+            #else
+            next_oparg = (int)CURRENT_OPERAND0();
+            #endif
+            _PyStackRef *target_local = &GETLOCAL(next_oparg);
+            if (PyStackRef_AsPyObjectBorrow(*target_local) != left_o) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            Py_ssize_t value = _PyLong_CompactValue((PyLongObject *)left_o)
+            + _PyLong_CompactValue((PyLongObject *)right_o);
+            if (!_PyLong_IsCompactValue(value)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(BINARY_OP, hit);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyObject *temp = PyStackRef_AsPyObjectSteal(*target_local);
+            stack_pointer += -2;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            _PyCompactLong_InplaceStore(&temp, value);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            *target_local = PyStackRef_FromPyObjectSteal(temp);
+            if (PyStackRef_IsNull(*target_local)) {
+                JUMP_TO_ERROR();
+            }
+            #if TIER_ONE
+            assert(next_instr->op.code == STORE_FAST);
+            SKIP_OVER(1);
+            #endif
+            break;
+        }
+
+        case _BINARY_OP_INPLACE_SUBTRACT_INT: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            assert(_PyLong_BothAreCompact((PyLongObject *)left_o, (PyLongObject *)right_o));
+            int next_oparg;
+            #if TIER_ONE
+            assert(next_instr->op.code == STORE_FAST);
+            next_oparg = next_instr->op.arg;
+            #else
+            next_oparg = (int)CURRENT_OPERAND0();
+            #endif
+            _PyStackRef *target_local = &GETLOCAL(next_oparg);
+            if (PyStackRef_AsPyObjectBorrow(*target_local) != left_o) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            Py_ssize_t value = _PyLong_CompactValue((PyLongObject *)left_o)
+            - _PyLong_CompactValue((PyLongObject *)right_o);
+            if (!_PyLong_IsCompactValue(value)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(BINARY_OP, hit);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyObject *temp = PyStackRef_AsPyObjectSteal(*target_local);
+            stack_pointer += -2;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            _PyCompactLong_InplaceStore(&temp, value);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            *target_local = PyStackRef_FromPyObjectSteal(temp);
+            if (PyStackRef_IsNull(*target_local)) {
+                JUMP_TO_ERROR();
+            }
+            #if TIER_ONE
+            assert(next_instr->op.code == STORE_FAST);
+            SKIP_OVER(1);
+            #endif
+            break;
+        }
+
         case _GUARD_NOS_FLOAT: {
             _PyStackRef left;
             left = stack_pointer[-2];
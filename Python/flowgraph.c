@@ -3297,6 +3297,65 @@ add_checks_for_loads_of_uninitialized_variables(basicblock *entryblock,
     return SUCCESS;
 }
 
+/* Remove stores to locals which have no visible effect, using the
+ * b_unsafe_locals_mask computed for each block by
+ * add_checks_for_loads_of_uninitialized_variables():
+ *  - "LOAD_FAST x; STORE_FAST x" (the LOAD_FAST cannot fail);
+ *  - "STORE_FAST x; DELETE_FAST x" on the same line, if x is known to
+ *    be initialized before the store, as in the cleanup of "except E as x".
+ * Only the first 64 locals are tracked.
+ */
+static int
+remove_dead_local_stores(cfg_builder *g)
+{
+    for (basicblock *b = g->g_entryblock; b != NULL; b = b->b_next) {
+        // bit i is set if local i is potentially uninitialized
+        uint64_t unsafe_mask = b->b_unsafe_locals_mask;
+        for (int i = 0; i < b->b_iused; i++) {
+            cfg_instr *instr = &b->b_instr[i];
+            cfg_instr *next = i + 1 < b->b_iused ? &b->b_instr[i + 1] : NULL;
+            int oparg = instr->i_oparg;
+            bool same_local = (next != NULL && next->i_oparg == oparg);
+            uint64_t bit = oparg < 64 ? (uint64_t)1 << oparg : 0;
+            switch (instr->i_opcode) {
+                case LOAD_FAST:
+                    if (same_local && next->i_opcode == STORE_FAST) {
+                        INSTR_SET_OP0(instr, NOP);
+                        INSTR_SET_OP0(next, NOP);
+                        i++;
+                    }
+                    unsafe_mask &= ~bit;
+                    break;
+                case STORE_FAST:
+                    if (same_local && next->i_opcode == DELETE_FAST &&
+                        bit != 0 && (unsafe_mask & bit) == 0 &&
+                        instr->i_loc.lineno == next->i_loc.lineno)
+                    {
+                        cfg_instr *prev = i > 0 ? &b->b_instr[i - 1] : NULL;
+                        if (prev != NULL && loads_const(prev->i_opcode)) {
+                            INSTR_SET_OP0(prev, NOP);
+                            INSTR_SET_OP0(instr, NOP);
+                        }
+                        else {
+                            INSTR_SET_OP0(instr, POP_TOP);
+                        }
+                    }
+                    unsafe_mask &= ~bit;
+                    break;
+                case LOAD_FAST_CHECK:
+                    unsafe_mask &= ~bit;
+                    break;
+                case DELETE_FAST:
+                case LOAD_FAST_AND_CLEAR:
+                case STORE_FAST_MAYBE_NULL:
+                    unsafe_mask |= bit;
+                    break;
+            }
+        }
+    }
+    return SUCCESS;
+}
+
 
 static int
 mark_warm(basicblock *entryblock) {
@@ -3653,10 +3712,11 @@ _PyCfg_OptimizeCodeUnit(cfg_builder *g, PyObject *consts, PyObject *const_cache,
 
     /** Optimization **/
     RETURN_IF_ERROR(optimize_cfg(g, consts, const_cache, firstlineno));
-    RETURN_IF_ERROR(remove_unused_consts(g->g_entryblock, consts));
     RETURN_IF_ERROR(
         add_checks_for_loads_of_uninitialized_variables(
             g->g_entryblock, nlocals, nparams));
+    RETURN_IF_ERROR(remove_dead_local_stores(g));
+    RETURN_IF_ERROR(remove_unused_consts(g->g_entryblock, consts));
     RETURN_IF_ERROR(insert_superinstructions(g));
 
     RETURN_IF_ERROR(push_cold_blocks_to_end(g));
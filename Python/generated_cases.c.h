@@ -323,6 +323,90 @@
             DISPATCH();
         }
 
+        TARGET(BINARY_OP_INPLACE_ADD_INT) {
+            #if _Py_TAIL_CALL_INTERP
+            int opcode = BINARY_OP_INPLACE_ADD_INT;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 6;
+            INSTRUCTION_STATS(BINARY_OP_INPLACE_ADD_INT);
+            static_assert(INLINE_CACHE_ENTRIES_BINARY_OP == 5, "incorrect cache size");
+            _PyStackRef value;
+            _PyStackRef left;
+            _PyStackRef right;
+            // _GUARD_TOS_INT
+            {
+                value = stack_pointer[-1];
+                PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+                if (!_PyLong_CheckExactAndCompact(value_o)) {
+                    UPDATE_MISS_STATS(BINARY_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (BINARY_OP));
+                    JUMP_TO_PREDICTED(BINARY_OP);
+                }
+            }
+            // _GUARD_NOS_INT
+            {
+                left = stack_pointer[-2];
+                PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+                if (!_PyLong_CheckExactAndCompact(left_o)) {
+                    UPDATE_MISS_STATS(BINARY_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (BINARY_OP));
+                    JUMP_TO_PREDICTED(BINARY_OP);
+                }
+            }
+            /* Skip 5 cache entries */
+            // _BINARY_OP_INPLACE_ADD_INT
+            {
+                right = value;
+                PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+                PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+                assert(PyLong_CheckExact(left_o));
+                assert(PyLong_CheckExact(right_o));
+                assert(_PyLong_BothAreCompact((PyLongObject *)left_o, (PyLongObject *)right_o));
+                int next_oparg;
+                #if TIER_ONE
+                assert(next_instr->op.code == STORE_FAST);
+                next_oparg = next_instr->op.arg;
+                #else
+                next_oparg = (int)CURRENT_OPERAND0();
+                #endif
+                _PyStackRef *target_local = &GETLOCAL(next_oparg);
+                if (PyStackRef_AsPyObjectBorrow(*target_local) != left_o) {
+                    UPDATE_MISS_STATS(BINARY_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (BINARY_OP));
+                    JUMP_TO_PREDICTED(BINARY_OP);
+                }
+                Py_ssize_t value = _PyLong_CompactValue((PyLongObject *)left_o)
+                + _PyLong_CompactValue((PyLongObject *)right_o);
+                if (!_PyLong_IsCompactValue(value)) {
+                    UPDATE_MISS_STATS(BINARY_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (BINARY_OP));
+                    JUMP_TO_PREDICTED(BINARY_OP);
+                }
+                STAT_INC(BINARY_OP, hit);
+                PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+                PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+                PyObject *temp = PyStackRef_AsPyObjectSteal(*target_local);
+                stack_pointer += -2;
+                ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                _PyCompactLong_InplaceStore(&temp, value);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                *target_local = PyStackRef_FromPyObjectSteal(temp);
+                if (PyStackRef_IsNull(*target_local)) {
+                    JUMP_TO_LABEL(error);
+                }
+                #if TIER_ONE
+                assert(next_instr->op.code == STORE_FAST);
+                SKIP_OVER(1);
+                #endif
+            }
+            DISPATCH();
+        }
+
         TARGET(BINARY_OP_INPLACE_ADD_UNICODE) {
             #if _Py_TAIL_CALL_INTERP
             int opcode = BINARY_OP_INPLACE_ADD_UNICODE;
@@ -406,6 +490,90 @@
             DISPATCH();
         }
 
+        TARGET(BINARY_OP_INPLACE_SUBTRACT_INT) {
+            #if _Py_TAIL_CALL_INTERP
+            int opcode = BINARY_OP_INPLACE_SUBTRACT_INT;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 6;
+            INSTRUCTION_STATS(BINARY_OP_INPLACE_SUBTRACT_INT);
+            static_assert(INLINE_CACHE_ENTRIES_BINARY_OP == 5, "incorrect cache size");
+            _PyStackRef value;
+            _PyStackRef left;
+            _PyStackRef right;
+            // _GUARD_TOS_INT
+            {
+                value = stack_pointer[-1];
+                PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+                if (!_PyLong_CheckExactAndCompact(value_o)) {
+                    UPDATE_MISS_STATS(BINARY_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (BINARY_OP));
+                    JUMP_TO_PREDICTED(BINARY_OP);
+                }
+            }
+            // _GUARD_NOS_INT
+            {
+                left = stack_pointer[-2];
+                PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+                if (!_PyLong_CheckExactAndCompact(left_o)) {
+                    UPDATE_MISS_STATS(BINARY_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (BINARY_OP));
+                    JUMP_TO_PREDICTED(BINARY_OP);
+                }
+            }
+            /* Skip 5 cache entries */
+            // _BINARY_OP_INPLACE_SUBTRACT_INT
+            {
+                right = value;
+                PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+                PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+                assert(PyLong_CheckExact(left_o));
+                assert(PyLong_CheckExact(right_o));
+                assert(_PyLong_BothAreCompact((PyLongObject *)left_o, (PyLongObject *)right_o));
+                int next_oparg;
+                #if TIER_ONE
+                assert(next_instr->op.code == STORE_FAST);
+                next_oparg = next_instr->op.arg;
+                #else
+                next_oparg = (int)CURRENT_OPERAND0();
+                #endif
+                _PyStackRef *target_local = &GETLOCAL(next_oparg);
+                if (PyStackRef_AsPyObjectBorrow(*target_local) != left_o) {
+                    UPDATE_MISS_STATS(BINARY_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (BINARY_OP));
+                    JUMP_TO_PREDICTED(BINARY_OP);
+                }
+                Py_ssize_t value = _PyLong_CompactValue((PyLongObject *)left_o)
+                - _PyLong_CompactValue((PyLongObject *)right_o);
+                if (!_PyLong_IsCompactValue(value)) {
+                    UPDATE_MISS_STATS(BINARY_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (BINARY_OP));
+                    JUMP_TO_PREDICTED(BINARY_OP);
+                }
+                STAT_INC(BINARY_OP, hit);
+                PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+                PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+                PyObject *temp = PyStackRef_AsPyObjectSteal(*target_local);
+                stack_pointer += -2;
+                ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                _PyCompactLong_InplaceStore(&temp, value);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                *target_local = PyStackRef_FromPyObjectSteal(temp);
+                if (PyStackRef_IsNull(*target_local)) {
+                    JUMP_TO_LABEL(error);
+                }
+                #if TIER_ONE
+                assert(next_instr->op.code == STORE_FAST);
+                SKIP_OVER(1);
+                #endif
+            }
+            DISPATCH();
+        }
+
         TARGET(BINARY_OP_MULTIPLY_FLOAT) {
             #if _Py_TAIL_CALL_INTERP
             int opcode = BINARY_OP_MULTIPLY_FLOAT;
@@ -11390,7 +11558,9 @@
             _PyThreadStateImpl *_tstate = (_PyThreadStateImpl *)tstate;
             if ((_tstate->jit_tracer_state.prev_state.instr->op.code == CALL_LIST_APPEND &&
                  opcode == POP_TOP) ||
-                (_tstate->jit_tracer_state.prev_state.instr->op.code == BINARY_OP_INPLACE_ADD_UNICODE &&
+                ((_tstate->jit_tracer_state.prev_state.instr->op.code == BINARY_OP_INPLACE_ADD_UNICODE ||
+                  _tstate->jit_tracer_state.prev_state.instr->op.code == BINARY_OP_INPLACE_ADD_INT ||
+                  _tstate->jit_tracer_state.prev_state.instr->op.code == BINARY_OP_INPLACE_SUBTRACT_INT) &&
                  opcode == STORE_FAST)) {
                 _tstate->jit_tracer_state.prev_state.instr_is_super = true;
             }
@@ -370,6 +370,8 @@ static const char usage_envvars[] =
 "                  The default module search path uses %s.\n"
 "PYTHONPLATLIBDIR: override sys.platlibdir\n"
 "PYTHONCASEOK    : ignore case in 'import' statements (Windows)\n"
+"PYTHONIMPORTDIRCACHE: file used to keep the listings of import directories\n"
+"                  between runs\n"
 "PYTHONIOENCODING: encoding[:errors] used for stdin/stdout/stderr\n"
 "PYTHONHASHSEED  : if this variable is set to 'random', a random value is used\n"
 "                  to seed the hashes of str and bytes objects.  It can also be\n"
@@ -2,12 +2,14 @@
 #define _PY_INTERPRETER
 
 #include "Python.h"
+#include "pycore_code.h"          // _PyCode_GetMatchTable()
 #include "pycore_compile.h"       // _PyCompile_GetUnaryIntrinsicName
 #include "pycore_function.h"      // _Py_set_function_type_params()
 #include "pycore_genobject.h"     // _PyAsyncGenValueWrapperNew
 #include "pycore_interpframe.h"   // _PyFrame_GetLocals()
 #include "pycore_intrinsics.h"    // INTRINSIC_PRINT
 #include "pycore_pyerrors.h"      // _PyErr_SetString()
+#include "pycore_pystate.h"       // _Py_GetConfig()
 #include "pycore_runtime.h"       // _Py_ID()
 #include "pycore_typevarobject.h" // _Py_make_typevar()
 #include "pycore_unicodeobject.h" // _PyUnicode_FromASCII()
@@ -254,6 +256,53 @@ make_typevar_with_constraints(PyThreadState* Py_UNUSED(ignored), PyObject *name,
     return _Py_make_typevar(name, NULL, evaluate_constraints);
 }
 
+/* Return the index of the first case of a run of literal value patterns
+   matching subject, or -1.  cases is a tuple of (value, index) pairs.
+   Comparing the subject with each value is only skipped for the exact
+   built-in types whose equality agrees with their hash, and not under -b,
+   where comparing bytes with str or int warns. */
+static PyObject *
+match_value_dispatch(PyThreadState* tstate, PyObject *subject,
+                     PyObject *cases)
+{
+    assert(PyTuple_CheckExact(cases));
+    PyTypeObject *tp = Py_TYPE(subject);
+    int use_table = (tp == &PyLong_Type || tp == &PyBool_Type ||
+                     tp == &PyFloat_Type || tp == &PyComplex_Type ||
+                     tp == &PyUnicode_Type || tp == &PyBytes_Type);
+    if (use_table && !_Py_GetConfig()->bytes_warning) {
+        PyCodeObject *co = _PyFrame_GetCode(tstate->current_frame);
+        PyObject *table = _PyCode_GetMatchTable(co, cases);
+        if (table == NULL) {
+            return NULL;
+        }
+        PyObject *index;
+        int res = PyDict_GetItemRef(table, subject, &index);
+        Py_DECREF(table);
+        if (res != 0) {
+            return index;
+        }
+        return PyLong_FromLong(-1);
+    }
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(cases); i++) {
+        PyObject *pair = PyTuple_GET_ITEM(cases, i);
+        PyObject *res = PyObject_RichCompare(subject, PyTuple_GET_ITEM(pair, 0),
+                                             Py_EQ);
+        if (res == NULL) {
+            return NULL;
+        }
+        int match = PyObject_IsTrue(res);
+        Py_DECREF(res);
+        if (match < 0) {
+            return NULL;
+        }
+        if (match) {
+            return Py_NewRef(PyTuple_GET_ITEM(pair, 1));
+        }
+    }
+    return PyLong_FromLong(-1);
+}
+
 const intrinsic_func2_info
 _PyIntrinsics_BinaryFunctions[] = {
     INTRINSIC_FUNC_ENTRY(INTRINSIC_2_INVALID, no_intrinsic2)
@@ -262,6 +311,7 @@ _PyIntrinsics_BinaryFunctions[] = {
     INTRINSIC_FUNC_ENTRY(INTRINSIC_TYPEVAR_WITH_CONSTRAINTS, make_typevar_with_constraints)
     INTRINSIC_FUNC_ENTRY(INTRINSIC_SET_FUNCTION_TYPE_PARAMS, _Py_set_function_type_params)
     INTRINSIC_FUNC_ENTRY(INTRINSIC_SET_TYPEPARAM_DEFAULT, _Py_set_typeparam_default)
+    INTRINSIC_FUNC_ENTRY(INTRINSIC_MATCH_VALUE_DISPATCH, match_value_dispatch)
 };
 
 #undef INTRINSIC_FUNC_ENTRY
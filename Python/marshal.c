@@ -1502,6 +1502,10 @@ r_object(RFILE *p)
         break;
 
     case TYPE_CODE:
+        /* Nested code objects are read eagerly: they cannot be skipped and
+           materialized later, because objects read after them may refer
+           back (TYPE_REF) to objects first seen inside them, and the
+           index of every following reference depends on their contents. */
         {
             int argcount;
             int posonlyargcount;
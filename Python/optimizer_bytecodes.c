@@ -301,6 +301,18 @@ dummy_func(void) {
         GETLOCAL(this_instr->operand0) = res;
     }
 
+    op(_BINARY_OP_INPLACE_ADD_INT, (left, right -- )) {
+        JitOptRef res = sym_new_compact_int(ctx);
+        // _STORE_FAST:
+        GETLOCAL(this_instr->operand0) = res;
+    }
+
+    op(_BINARY_OP_INPLACE_SUBTRACT_INT, (left, right -- )) {
+        JitOptRef res = sym_new_compact_int(ctx);
+        // _STORE_FAST:
+        GETLOCAL(this_instr->operand0) = res;
+    }
+
     op(_BINARY_OP_SUBSCR_INIT_CALL, (container, sub, getitem  -- new_frame)) {
         new_frame = PyJitRef_NULL;
         ctx->done = true;
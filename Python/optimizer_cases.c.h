@@ -639,6 +639,24 @@
             break;
         }
 
+        case _BINARY_OP_INPLACE_ADD_INT: {
+            JitOptRef res = sym_new_compact_int(ctx);
+            GETLOCAL(this_instr->operand0) = res;
+            CHECK_STACK_BOUNDS(-2);
+            stack_pointer += -2;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
+        case _BINARY_OP_INPLACE_SUBTRACT_INT: {
+            JitOptRef res = sym_new_compact_int(ctx);
+            GETLOCAL(this_instr->operand0) = res;
+            CHECK_STACK_BOUNDS(-2);
+            stack_pointer += -2;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
         case _GUARD_NOS_FLOAT: {
             JitOptRef left;
             left = stack_pointer[-2];
@@ -9,6 +9,7 @@
 #include "pycore_critical_section.h" // _PyCriticalSection_Resume()
 #include "pycore_dtoa.h"          // _dtoa_state_INIT()
 #include "pycore_freelist.h"      // _PyObject_ClearFreeLists()
+#include "pycore_index_pool.h"    // _PyIndexPool_Fini()
 #include "pycore_initconfig.h"    // _PyStatus_OK()
 #include "pycore_interpframe.h"   // _PyThreadState_HasStackSpace()
 #include "pycore_object.h"        // _PyType_InitCache()
@@ -959,6 +960,7 @@ PyInterpreterState_Delete(PyInterpreterState *interp)
     _Py_qsbr_fini(interp);
 
     _PyObject_FiniState(interp);
+    _PyIndexPool_Fini(&interp->threading_local_indices);
 
     PyConfig_Clear(&interp->config);
 
@@ -1410,10 +1412,19 @@ alloc_threadstate(PyInterpreterState *interp)
     return tstate;
 }
 
+static void
+clear_threading_local_cache(_PyThreadStateImpl *tstate)
+{
+    PyMem_RawFree(tstate->threading_local_cache.entries);
+    tstate->threading_local_cache.entries = NULL;
+    tstate->threading_local_cache.size = 0;
+}
+
 static void
 free_threadstate(_PyThreadStateImpl *tstate)
 {
     PyInterpreterState *interp = tstate->base.interp;
+    clear_threading_local_cache(tstate);
 #ifdef Py_STATS
     _PyStats_ThreadFini(tstate);
 #endif
@@ -1716,6 +1727,9 @@ PyThreadState_Clear(PyThreadState *tstate)
 
     /* Don't clear tstate->pyframe: it is a borrowed reference */
 
+    // Releasing the sentinel below frees the threading.local dicts of this
+    // thread, and their finalizers may access threading.local objects again.
+    clear_threading_local_cache((_PyThreadStateImpl *)tstate);
     Py_CLEAR(tstate->threading_local_key);
     Py_CLEAR(tstate->threading_local_sentinel);
 
@@ -1796,7 +1810,8 @@ PyThreadState_Clear(PyThreadState *tstate)
 }
 
 static void
-decrement_stoptheworld_countdown(struct _stoptheworld_state *stw);
+decrement_stoptheworld_countdown(struct _stoptheworld_state *stw,
+                                 PyThreadState *tstate);
 
 /* Common code for PyThreadState_Delete() and PyThreadState_DeleteCurrent() */
 static void
@@ -1826,10 +1841,10 @@ tstate_delete_common(PyThreadState *tstate, int release_gil)
         // Any ongoing stop-the-world request should not wait for us because
         // our thread is getting deleted.
         if (interp->stoptheworld.requested) {
-            decrement_stoptheworld_countdown(&interp->stoptheworld);
+            decrement_stoptheworld_countdown(&interp->stoptheworld, tstate);
         }
         if (runtime->stoptheworld.requested) {
-            decrement_stoptheworld_countdown(&runtime->stoptheworld);
+            decrement_stoptheworld_countdown(&runtime->stoptheworld, tstate);
         }
     }
 
@@ -2254,7 +2269,7 @@ _PyThreadState_Suspend(PyThreadState *tstate)
 
     // Decrease the count of remaining threads needing to park.
     HEAD_LOCK(runtime);
-    decrement_stoptheworld_countdown(stw);
+    decrement_stoptheworld_countdown(stw, tstate);
     HEAD_UNLOCK(runtime);
 }
 
@@ -2270,10 +2285,12 @@ _PyThreadState_SetShuttingDown(PyThreadState *tstate)
 // Decrease stop-the-world counter of remaining number of threads that need to
 // pause. If we are the final thread to pause, notify the requesting thread.
 static void
-decrement_stoptheworld_countdown(struct _stoptheworld_state *stw)
+decrement_stoptheworld_countdown(struct _stoptheworld_state *stw,
+                                 PyThreadState *tstate)
 {
     assert(stw->thread_countdown > 0);
     if (--stw->thread_countdown == 0) {
+        stw->last_thread_id = tstate->thread_id;
         _PyEvent_Notify(&stw->stop_event);
     }
 }
@@ -2305,6 +2322,7 @@ static bool
 park_detached_threads(struct _stoptheworld_state *stw)
 {
     int num_parked = 0;
+    PyThreadState *last_parked = NULL;
     _Py_FOR_EACH_STW_INTERP(stw, i) {
         _Py_FOR_EACH_TSTATE_UNLOCKED(i, t) {
             int state = _Py_atomic_load_int_relaxed(&t->state);
@@ -2313,6 +2331,7 @@ park_detached_threads(struct _stoptheworld_state *stw)
                 if (_Py_atomic_compare_exchange_int(
                                 &t->state, &state, _Py_THREAD_SUSPENDED)) {
                     num_parked++;
+                    last_parked = t;
                 }
             }
             else if (state == _Py_THREAD_ATTACHED && t != stw->requester) {
@@ -2322,7 +2341,11 @@ park_detached_threads(struct _stoptheworld_state *stw)
     }
     stw->thread_countdown -= num_parked;
     assert(stw->thread_countdown >= 0);
-    return num_parked > 0 && stw->thread_countdown == 0;
+    if (num_parked > 0 && stw->thread_countdown == 0) {
+        stw->last_thread_id = last_parked->thread_id;
+        return true;
+    }
+    return false;
 }
 
 static void
@@ -2345,6 +2368,8 @@ stop_the_world(struct _stoptheworld_state *stw)
     stw->thread_countdown = 0;
     stw->stop_event = (PyEvent){0};  // zero-initialize (unset)
     stw->requester = _PyThreadState_GET();  // may be NULL
+    stw->last_thread_id = 0;
+    (void)PyTime_PerfCounterRaw(&stw->request_time);
     FT_STAT_WORLD_STOP_INC();
 
     _Py_FOR_EACH_STW_INTERP(stw, i) {
@@ -2359,6 +2384,7 @@ stop_the_world(struct _stoptheworld_state *stw)
     if (stw->thread_countdown == 0) {
         HEAD_UNLOCK(runtime);
         stw->world_stopped = 1;
+        stw->stopped_time = stw->request_time;
         return;
     }
 
@@ -2381,6 +2407,28 @@ stop_the_world(struct _stoptheworld_state *stw)
         HEAD_LOCK(runtime);
     }
     stw->world_stopped = 1;
+    (void)PyTime_PerfCounterRaw(&stw->stopped_time);
+}
+
+// Record the pause that is ending in the statistics of stw.
+static void
+update_stoptheworld_stats(struct _stoptheworld_state *stw)
+{
+    PyTime_t now;
+    (void)PyTime_PerfCounterRaw(&now);
+    struct _stoptheworld_stats *stats = &stw->stats;
+    PyTime_t time_to_stop = stw->stopped_time - stw->request_time;
+    PyTime_t pause = now - stw->stopped_time;
+    stats->count++;
+    stats->total_time_to_stop += time_to_stop;
+    stats->max_time_to_stop = Py_MAX(stats->max_time_to_stop, time_to_stop);
+    stats->total_pause += pause;
+    stats->max_pause = Py_MAX(stats->max_pause, pause);
+    stats->last_requester_id = (stw->requester != NULL
+                                ? stw->requester->thread_id : 0);
+    stats->last_slowest_thread_id = stw->last_thread_id;
+    stats->last_time_to_stop = time_to_stop;
+    stats->last_pause = pause;
 }
 
 static void
@@ -2390,6 +2438,7 @@ start_the_world(struct _stoptheworld_state *stw)
     assert(PyMutex_IsLocked(&stw->mutex));
 
     HEAD_LOCK(runtime);
+    update_stoptheworld_stats(stw);
     stw->requested = 0;
     stw->world_stopped = 0;
     // Switch threads back to the detached state.
@@ -1551,6 +1551,10 @@ _Py_CompileStringObjectWithModule(const char *str, PyObject *filename, int start
             _PyArena_Free(arena);
             return NULL;
         }
+        if ((flags->cf_flags & PyCF_LAZY_AST) == PyCF_LAZY_AST) {
+            /* The nodes keep the arena alive until they are converted. */
+            return PyAST_mod2obj_lazy(mod, arena);
+        }
         PyObject *result = PyAST_mod2obj(mod);
         _PyArena_Free(arena);
         return result;
@@ -2196,6 +2196,12 @@ _Py_Specialize_BinaryOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *in
                 return;
             }
             if (_PyLong_CheckExactAndCompact(lhs) && _PyLong_CheckExactAndCompact(rhs)) {
+                _Py_CODEUNIT next = instr[INLINE_CACHE_ENTRIES_BINARY_OP + 1];
+                bool to_store = (next.op.code == STORE_FAST);
+                if (to_store && PyStackRef_AsPyObjectBorrow(locals[next.op.arg]) == lhs) {
+                    specialize(instr, BINARY_OP_INPLACE_ADD_INT);
+                    return;
+                }
                 specialize(instr, BINARY_OP_ADD_INT);
                 return;
             }
@@ -2224,6 +2230,12 @@ _Py_Specialize_BinaryOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *in
                 break;
             }
             if (_PyLong_CheckExactAndCompact(lhs) && _PyLong_CheckExactAndCompact(rhs)) {
+                _Py_CODEUNIT next = instr[INLINE_CACHE_ENTRIES_BINARY_OP + 1];
+                bool to_store = (next.op.code == STORE_FAST);
+                if (to_store && PyStackRef_AsPyObjectBorrow(locals[next.op.arg]) == lhs) {
+                    specialize(instr, BINARY_OP_INPLACE_SUBTRACT_INT);
+                    return;
+                }
                 specialize(instr, BINARY_OP_SUBTRACT_INT);
                 return;
             }
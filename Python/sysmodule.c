@@ -2669,6 +2669,90 @@ sys__is_gil_enabled_impl(PyObject *module)
 }
 
 
+static int
+stoptheworld_stats_to_dict(PyObject *dict, struct _stoptheworld_stats *stats)
+{
+#define SET_ITEM(KEY, VALUE)                                    \
+    do {                                                        \
+        PyObject *value = (VALUE);                              \
+        if (value == NULL) {                                    \
+            return -1;                                          \
+        }                                                       \
+        int res = PyDict_SetItemString(dict, (KEY), value);     \
+        Py_DECREF(value);                                       \
+        if (res < 0) {                                          \
+            return -1;                                          \
+        }                                                       \
+    } while (0)
+#define SET_TIME(KEY, VALUE) \
+    SET_ITEM(KEY, PyFloat_FromDouble(PyTime_AsSecondsDouble(VALUE)))
+
+    SET_ITEM("count", PyLong_FromSsize_t(stats->count));
+    SET_TIME("total_time_to_stop", stats->total_time_to_stop);
+    SET_TIME("max_time_to_stop", stats->max_time_to_stop);
+    SET_TIME("total_pause", stats->total_pause);
+    SET_TIME("max_pause", stats->max_pause);
+    SET_TIME("last_time_to_stop", stats->last_time_to_stop);
+    SET_TIME("last_pause", stats->last_pause);
+    SET_ITEM("last_requester_id",
+             PyLong_FromUnsignedLong(stats->last_requester_id));
+    SET_ITEM("last_slowest_thread_id",
+             PyLong_FromUnsignedLong(stats->last_slowest_thread_id));
+    return 0;
+
+#undef SET_TIME
+#undef SET_ITEM
+}
+
+
+/*[clinic input]
+sys._get_stop_the_world_stats
+
+Return statistics on the stop-the-world pauses of the interpreter.
+
+The "global" key holds the statistics on the pauses of all interpreters.
+Durations are in seconds.  On builds with the GIL, all values are zero.
+[clinic start generated code]*/
+
+static PyObject *
+sys__get_stop_the_world_stats_impl(PyObject *module)
+/*[clinic end generated code: output=bb785a90176b5fc7 input=777db5040ddecb9f]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    _PyRuntimeState *runtime = &_PyRuntime;
+
+    // Copy the statistics while no pause can end.
+    HEAD_LOCK(runtime);
+    struct _stoptheworld_stats interp_stats = interp->stoptheworld.stats;
+    struct _stoptheworld_stats global_stats = runtime->stoptheworld.stats;
+    HEAD_UNLOCK(runtime);
+
+    PyObject *result = PyDict_New();
+    if (result == NULL) {
+        return NULL;
+    }
+    PyObject *global = PyDict_New();
+    if (global == NULL) {
+        goto error;
+    }
+    if (stoptheworld_stats_to_dict(global, &global_stats) < 0
+        || PyDict_SetItemString(result, "global", global) < 0)
+    {
+        Py_DECREF(global);
+        goto error;
+    }
+    Py_DECREF(global);
+    if (stoptheworld_stats_to_dict(result, &interp_stats) < 0) {
+        goto error;
+    }
+    return result;
+
+error:
+    Py_DECREF(result);
+    return NULL;
+}
+
+
 #ifndef MS_WINDOWS
 static PerfMapState perf_map_state;
 #endif
@@ -2848,6 +2932,7 @@ static PyMethodDef sys_methods[] = {
 #endif
     SYS__GET_CPU_COUNT_CONFIG_METHODDEF
     SYS__IS_GIL_ENABLED_METHODDEF
+    SYS__GET_STOP_THE_WORLD_STATS_METHODDEF
     SYS__DUMP_TRACELETS_METHODDEF
     {NULL, NULL}  // sentinel
 };
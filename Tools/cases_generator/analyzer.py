@@ -644,6 +644,7 @@ def has_error_without_pop(op: parser.CodeDef) -> bool:
     "_PyLong_CompactValue",
     "_PyLong_DigitCount",
     "_PyLong_IsCompact",
+    "_PyLong_IsCompactValue",
     "_PyLong_IsNegative",
     "_PyLong_IsNonNegativeCompact",
     "_PyLong_IsZero",
@@ -1328,14 +1329,18 @@ def analyze_forest(forest: list[parser.AstNode]) -> Analysis:
                 pass
     for uop in uops.values():
         uop.instruction_size = get_instruction_size_for_uop(instructions, uop)
-    # Special case BINARY_OP_INPLACE_ADD_UNICODE
-    # BINARY_OP_INPLACE_ADD_UNICODE is not a normal family member,
-    # as it is the wrong size, but we need it to maintain an
-    # historical optimization.
-    if "BINARY_OP_INPLACE_ADD_UNICODE" in instructions:
-        inst = instructions["BINARY_OP_INPLACE_ADD_UNICODE"]
-        inst.family = families["BINARY_OP"]
-        families["BINARY_OP"].members.append(inst)
+    # Special case the BINARY_OP_INPLACE_* super-instructions.
+    # They are not normal family members, as they are the wrong size
+    # (they also perform the STORE_FAST that follows them).
+    for name in (
+        "BINARY_OP_INPLACE_ADD_UNICODE",
+        "BINARY_OP_INPLACE_ADD_INT",
+        "BINARY_OP_INPLACE_SUBTRACT_INT",
+    ):
+        if name in instructions:
+            inst = instructions[name]
+            inst.family = families["BINARY_OP"]
+            families["BINARY_OP"].members.append(inst)
     opmap, first_arg, min_instrumented = assign_opcodes(instructions, families, pseudos)
     return Analysis(
         instructions, uops, families, pseudos, labels, opmap, first_arg, min_instrumented
@@ -20,10 +20,21 @@
 # AMD:
 # > echo "0" | sudo tee /sys/devices/system/cpu/cpufreq/boost
 #
+# To track scaling regressions across builds, sweep the thread counts and
+# save the results as JSON, then compare a later run against that file:
+#
+# > ./python Tools/ftscalingbench/ftscalingbench.py --sweep --repeat 5 \
+#       --json baseline.json
+# > ./python Tools/ftscalingbench/ftscalingbench.py --sweep --repeat 5 \
+#       --compare baseline.json
+#
 
+import json
 import math
 import os
+import platform
 import queue
+import statistics
 import sys
 import threading
 import time
@@ -203,6 +214,107 @@ def method_caller():
     for i in range(1000 * WORK_SCALE):
         mc(obj)
 
+thread_local_write_obj = threading.local()
+
+@register_benchmark
+def thread_local_write():
+    tmp = thread_local_write_obj
+    for i in range(500 * WORK_SCALE):
+        tmp.x = i
+        tmp.y = i
+        tmp.z = i
+
+@register_benchmark
+def dict_mutation():
+    # Each thread mutates its own dict.
+    d = {}
+    for i in range(500 * WORK_SCALE):
+        d[i & 63] = i
+        d.pop((i + 32) & 63, None)
+    return len(d)
+
+@register_benchmark
+def list_mutation():
+    lst = []
+    for i in range(500 * WORK_SCALE):
+        lst.append(i)
+        if len(lst) > 64:
+            lst.clear()
+    return len(lst)
+
+@register_benchmark
+def set_mutation():
+    st = set()
+    for i in range(500 * WORK_SCALE):
+        st.add(i & 127)
+        st.discard((i + 64) & 127)
+    return len(st)
+
+shared_dict = {str(i): i for i in range(64)}
+
+@register_benchmark
+def shared_dict_read():
+    d = shared_dict
+    accu = 0
+    for i in range(500 * WORK_SCALE):
+        accu += d["1"]
+        accu += d["42"]
+    return accu
+
+class SharedObject:
+    def __init__(self):
+        self.a = 1
+        self.b = 2
+
+    def method(self):
+        return self.a
+
+shared_object = SharedObject()
+
+@register_benchmark
+def shared_attr_read():
+    obj = shared_object
+    accu = 0
+    for i in range(1000 * WORK_SCALE):
+        accu += obj.a + obj.b
+    return accu
+
+@register_benchmark
+def shared_method_call():
+    obj = shared_object
+    accu = 0
+    for i in range(1000 * WORK_SCALE):
+        accu += obj.method()
+    return accu
+
+GLOBAL_CONSTANT = 3
+
+@register_benchmark
+def module_global_read():
+    accu = 0
+    for i in range(1000 * WORK_SCALE):
+        accu += GLOBAL_CONSTANT
+    return accu
+
+class Node:
+    def __init__(self):
+        self.next = self
+
+@register_benchmark
+def gc_under_load():
+    # Allocate reference cycles so that the cyclic GC runs while other
+    # threads are allocating too.
+    for i in range(100 * WORK_SCALE):
+        Node()
+        [Node() for _ in range(4)]
+
+@register_benchmark
+def allocate_small_objects():
+    for i in range(500 * WORK_SCALE):
+        t = (i, i)
+        l = [i]
+        f = float(i)
+
 @dataclass
 class MyDataClass:
     x: int
@@ -221,21 +333,39 @@ def bench_one_thread(func):
     return t1 - t0
 
 
-def bench_parallel(func):
+def bench_parallel(func, nthreads=None):
+    if nthreads is None:
+        nthreads = len(in_queues)
     t0 = time.perf_counter_ns()
-    for inq in in_queues:
+    for inq in in_queues[:nthreads]:
         inq.put(func)
-    for outq in out_queues:
+    for outq in out_queues[:nthreads]:
         outq.get()
     t1 = time.perf_counter_ns()
     return t1 - t0
 
 
-def benchmark(func):
-    delta_one_thread = bench_one_thread(func)
-    delta_many_threads = bench_parallel(func)
+def mean_and_ci(samples):
+    """Return the mean of samples and the half-width of its 95% confidence
+    interval (normal approximation)."""
+    mean = statistics.fmean(samples)
+    if len(samples) < 2:
+        return mean, 0.0
+    return mean, 1.96 * statistics.stdev(samples) / math.sqrt(len(samples))
+
+
+def measure_speedup(func, nthreads, repeat):
+    """Return the per-run speedups of running func on nthreads threads
+    compared to running it nthreads times on one thread."""
+    speedups = []
+    for _ in range(repeat):
+        delta_one_thread = bench_one_thread(func)
+        delta_many_threads = bench_parallel(func, nthreads)
+        speedups.append(delta_one_thread * nthreads / delta_many_threads)
+    return speedups
 
-    speedup = delta_one_thread * len(threads) / delta_many_threads
+
+def format_speedup(name, speedup, ci, nthreads):
     if speedup >= 1:
         factor = speedup
         direction = "faster"
@@ -248,11 +378,62 @@ def benchmark(func):
     if use_color:
         if speedup <= 1.1:
             color = "\x1b[31m"  # red
-        elif speedup < len(threads)/2:
+        elif speedup < nthreads/2:
             color = "\x1b[33m"  # yellow
         reset_color = "\x1b[0m"
 
-    print(f"{color}{func.__name__:<25} {round(factor, 1):>4}x {direction}{reset_color}")
+    line = f"{color}{name:<25} {round(factor, 1):>4}x {direction}"
+    if ci:
+        line += f" (speedup {speedup:.2f} \u00b1 {ci:.2f})"
+    return line + reset_color
+
+
+def benchmark(func, nthreads=None, repeat=1):
+    if nthreads is None:
+        nthreads = len(threads)
+    speedups = measure_speedup(func, nthreads, repeat)
+    speedup, ci = mean_and_ci(speedups)
+    print(format_speedup(func.__name__, speedup, ci, nthreads))
+    return {"speedup": speedup, "ci95": ci, "samples": speedups}
+
+
+def sweep_thread_counts(max_threads):
+    """Return 1, 2, 4, ... up to and including max_threads."""
+    counts = []
+    n = 1
+    while n < max_threads:
+        counts.append(n)
+        n *= 2
+    counts.append(max_threads)
+    return counts
+
+
+def compare_with_baseline(results, baseline, threshold):
+    """Print the benchmarks whose speedup dropped compared to baseline and
+    return the number of regressions.
+
+    A regression is reported when the new speedup is lower than the
+    baseline by more than *threshold* (a fraction) and the confidence
+    intervals of both runs do not overlap."""
+    regressions = 0
+    base_results = baseline["results"]
+    for name, by_threads in results.items():
+        for nthreads, new in by_threads.items():
+            old = base_results.get(name, {}).get(nthreads)
+            if old is None:
+                continue
+            change = new["speedup"] / old["speedup"] - 1
+            overlap = (new["speedup"] + new["ci95"] >=
+                       old["speedup"] - old["ci95"])
+            status = ""
+            if change < -threshold and not overlap:
+                status = "  REGRESSION"
+                regressions += 1
+            print(f"{name:<25} {nthreads:>3} threads "
+                  f"{old['speedup']:6.2f} -> {new['speedup']:6.2f} "
+                  f"({change:+.1%}){status}")
+    return regressions
+
 
 def determine_num_threads_and_affinity():
     if sys.platform != "linux":
@@ -303,6 +484,10 @@ def thread_run(cpu, in_queue, out_queue):
 def initialize_threads(opts):
     if opts.threads == -1:
         cpus = determine_num_threads_and_affinity()
+    elif opts.pin:
+        cpus = determine_num_threads_and_affinity()[:opts.threads]
+        if len(cpus) < opts.threads:
+            sys.stderr.write(f"only {len(cpus)} CPUs available for pinning\n")
     else:
         cpus = [None] * opts.threads  # don't set affinity
 
@@ -337,10 +522,21 @@ def main(opts):
         initialize_threads(opts)
 
     do_bench = not opts.baseline_only and not opts.parallel_only
+    if opts.sweep:
+        thread_counts = sweep_thread_counts(len(threads))
+    else:
+        thread_counts = [len(threads)]
+
+    results = {}
     for name in benchmark_names:
         func = ALL_BENCHMARKS[name]
         if do_bench:
-            benchmark(func)
+            results[name] = {}
+            for nthreads in thread_counts:
+                if opts.sweep:
+                    print(f"[{nthreads:>3} threads] ", end="")
+                results[name][str(nthreads)] = benchmark(
+                    func, nthreads, opts.repeat)
             continue
 
         if opts.parallel_only:
@@ -351,6 +547,32 @@ def main(opts):
         time_ms = delta_ns / 1_000_000
         print(f"{func.__name__:<18} {time_ms:.1f} ms")
 
+    if not do_bench:
+        return
+
+    if opts.json:
+        data = {
+            "python": sys.version,
+            "platform": platform.platform(),
+            "gil_enabled": getattr(sys, "_is_gil_enabled", lambda: True)(),
+            "scale": WORK_SCALE,
+            "repeat": opts.repeat,
+            "results": results,
+        }
+        with open(opts.json, "w") as f:
+            json.dump(data, f, indent=2)
+
+    if opts.compare:
+        with open(opts.compare) as f:
+            baseline = json.load(f)
+        print()
+        print(f"Comparison with {opts.compare}:")
+        regressions = compare_with_baseline(results, baseline,
+                                            opts.threshold)
+        if regressions:
+            print(f"{regressions} scaling regression(s) found")
+            sys.exit(1)
+
 
 if __name__ == "__main__":
     import argparse
@@ -358,13 +580,32 @@ def main(opts):
     parser = argparse.ArgumentParser()
     parser.add_argument("-t", "--threads", type=int, default=-1,
                         help="number of threads to use")
+    parser.add_argument("--pin", default=False, action="store_true",
+                        help="pin threads to distinct cores even when "
+                             "--threads is given (always done by default)")
     parser.add_argument("--scale", type=int, default=100,
                         help="work scale factor for the benchmark (default=100)")
     parser.add_argument("--baseline-only", default=False, action="store_true",
                         help="only run the baseline benchmarks (single thread)")
     parser.add_argument("--parallel-only", default=False, action="store_true",
                         help="only run the parallel benchmark (many threads)")
+    parser.add_argument("--sweep", default=False, action="store_true",
+                        help="measure 1, 2, 4, ... threads up to --threads")
+    parser.add_argument("--repeat", type=int, default=1,
+                        help="number of measurements per benchmark, used to "
+                             "compute a 95%% confidence interval (default=1)")
+    parser.add_argument("--json", metavar="FILE",
+                        help="write the results as JSON to FILE")
+    parser.add_argument("--compare", metavar="FILE",
+                        help="compare the results with a JSON file written "
+                             "by --json and exit with status 1 on "
+                             "regressions")
+    parser.add_argument("--threshold", type=float, default=0.1,
+                        help="relative speedup drop reported as a regression "
+                             "by --compare (default=0.1)")
     parser.add_argument("benchmarks", nargs="*",
                         help="benchmarks to run")
     options = parser.parse_args()
+    if options.repeat < 1:
+        parser.error("--repeat must be at least 1")
     main(options)